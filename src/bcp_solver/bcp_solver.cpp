@@ -4,135 +4,99 @@
 
 #include "bcp_solver.h"
 
-#include <queue>
-#include <random>
-#include <ranges>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <set>
+#include <stdexcept>
+#include <thread>
 #include <utility>
 
+#include "heuristic/CliqueLowerBound.h"
+#include "heuristic/Coloring.h"
+#include "heuristic/MultiStart.h"
+#include "heuristic/TabuSearch.h"
+#include "method/ComponentMethod.h"
+#include "method/KernelMethod.h"
 #include "method/OneVarGreaterMethod.h"
 #include "method/OneVarLessMethod.h"
+#include "method/PortfolioMethod.h"
 #include "method/StaircaseWithAuxiliaryVarsMethod.h"
 #include "method/StaircaseWithoutAuxiliaryVarsMethod.h"
+#include "method/TwoVarsGreaterLazyMethod.h"
 #include "method/TwoVarsGreaterMethod.h"
 #include "method/TwoVarsLessMethod.h"
 #include "sat_solver/Cadical.h"
 #include "sat_solver/Kissat.h"
+#include "span_search.h"
 
-void BCPSolver::BCPSolver::calculate_upper_bound()
+namespace
 {
-    const int n = graph->get_number_of_nodes();
-
-    std::vector colors(n, -1);
-
-    std::vector<std::set<int>> neighbouring_colors(n);
+    // Cubes handed to each cube thread, so that threads finishing early can take over the rest
+    constexpr int CUBES_PER_THREAD = 4;
 
-    using Element = std::pair<int, int>;
-    std::priority_queue<Element, std::vector<Element>, std::greater<>> saturations;
-
-    int max_color = 0;
-
-    std::vector<std::vector<std::pair<int, int>>> adj(n);
-    for (const auto edges = graph->get_edges(); const auto& edge : edges)
+    BCPSolver::SolverStatus from_sat_status(const int result)
     {
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        int w = std::get<2>(edge);
-
-        if (u >= 0 && u < n && v >= 0 && v < n)
+        switch (result)
         {
-            adj[u].emplace_back(v, w);
-            adj[v].emplace_back(u, w);
+        case CaDiCaL::Status::SATISFIABLE:
+            return BCPSolver::SATISFIABLE;
+        case CaDiCaL::Status::UNSATISFIABLE:
+            return BCPSolver::UNSATISFIABLE;
+        default:
+            return BCPSolver::UNKNOWN;
         }
     }
+}
 
-    auto has_uncolored = [&]() -> bool
-    {
-        return std::any_of(colors.begin(), colors.end(), [](const int c) { return c == -1; });
-    };
+void BCPSolver::BCPSolver::calculate_upper_bound()
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
 
-    auto get_start_node = [&]() -> int
-    {
-        int best_node = -1;
-        int max_deg = -1;
-        for (int i = 0; i < n; ++i)
-        {
-            if (colors[i] == -1)
-            {
-                if (const int deg = static_cast<int>(adj[i].size()); deg > max_deg)
-                {
-                    max_deg = deg;
-                    best_node = i;
-                }
-            }
-        }
-        return best_node;
-    };
+    MultiStartUpperBound heuristic(graph, options.upper_bound_threads, options.upper_bound_time_limit);
+    heuristic_coloring = heuristic.run();
+    upper_bound = get_coloring_span(heuristic_coloring);
+    upper_bound_variant = heuristic.get_winning_variant();
+    upper_bound_starts = heuristic.get_number_of_starts();
 
-    while (has_uncolored())
+    if (options.tabu_time_limit > 0)
     {
-        if (int start_node = get_start_node(); start_node != -1)
-        {
-            saturations.emplace(start_node, 0);
-        }
-
-        while (!saturations.empty())
-        {
-            std::pair<int, int> top = saturations.top();
-            saturations.pop();
-            int v = top.first;
-
-            if (colors[v] > -1)
-            {
-                continue;
-            }
-
-            colors[v] = 0;
-
-            std::vector<std::pair<int, int>> intervals;
-            for (const auto& neighbor : adj[v])
-            {
-                int w = neighbor.first;
-                int weight = neighbor.second;
-
-                if (colors[w] > -1)
-                {
-                    intervals.emplace_back(colors[w] - weight, colors[w] + weight);
-                }
-            }
+        TabuSearch tabu(graph, options.tabu_time_limit);
+        heuristic_coloring = tabu.run(heuristic_coloring);
+        upper_bound = get_coloring_span(heuristic_coloring);
+        tabu_iterations = tabu.get_iterations();
+    }
 
-            std::sort(intervals.begin(), intervals.end());
+    upper_bound_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+}
 
-            size_t invIndx = 0;
-            while (invIndx < intervals.size() && colors[v] > intervals[invIndx].first)
-            {
-                colors[v] = std::max(colors[v], intervals[invIndx].second);
-                invIndx++;
-            }
+void BCPSolver::BCPSolver::calculate_lower_bound()
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
 
-            max_color = std::max(max_color, colors[v]);
+    CliqueLowerBound clique(graph);
+    lower_bound = clique.run();
+    lower_bound_clique = clique.get_clique();
 
-            for (const auto& key : adj[v] | std::views::keys)
-            {
-                if (int w = key; colors[w] == -1)
-                {
-                    neighbouring_colors[w].insert(v);
-                    saturations.emplace(w, static_cast<int>(neighbouring_colors[w].size()));
-                }
-            }
-        }
-    }
+    lower_bound_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+}
 
-    upper_bound = max_color;
+bool BCPSolver::BCPSolver::starts_from_heuristic_coloring() const
+{
+    return !heuristic_coloring.empty() && get_coloring_span(heuristic_coloring) == span;
 }
 
 
 BCPSolver::BCPSolver::BCPSolver(const Graph* graph, const SATSolver::SOLVER solver, const int upper_bound,
                                 const bool use_symmetry_breaking,
-                                const bool use_heuristic)
+                                const bool use_heuristic, const SolverOptions& options)
     : graph(graph), upper_bound(upper_bound),
       use_symmetry_breaking(use_symmetry_breaking),
-      use_heuristic(use_heuristic)
+      use_heuristic(use_heuristic), options(options)
 {
     if (solver == SATSolver::CADICAL)
     {
@@ -142,11 +106,13 @@ BCPSolver::BCPSolver::BCPSolver(const Graph* graph, const SATSolver::SOLVER solv
     {
         sat_solver = std::make_unique<SATSolver::Kissat>();
     }
+    sat_solver->set_shared_clause_size(options.shared_clause_size);
 
     if (this->upper_bound < 0)
     {
         calculate_upper_bound();
     }
+    calculate_lower_bound();
 
     span = this->upper_bound;
 }
@@ -157,8 +123,29 @@ BCPSolver::BCPSolver* BCPSolver::BCPSolver::create_solver(const SolvingMethod me
                                                           const int upper_bound,
                                                           const bool use_symmetry_breaking,
                                                           const bool use_heuristic,
-                                                          const std::string& width)
+                                                          const std::string& width,
+                                                          const SolverOptions& options)
 {
+    if (options.cegar && options.probe_threads > 1)
+    {
+        throw std::invalid_argument("CEGAR refines a single formula and cannot probe spans on copies");
+    }
+
+    if (options.component_threads > 0)
+    {
+        if (const auto vertex_sets = ComponentMethod::find_components(graph); vertex_sets.size() > 1)
+        {
+            return new ComponentMethod(method, graph, solver, vertex_sets, upper_bound, use_symmetry_breaking,
+                                       use_heuristic, width, options);
+        }
+    }
+
+    if (options.kernelize)
+    {
+        return new KernelMethod(method, graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, width,
+                                options);
+    }
+
     switch (method)
     {
     case TwoVariablesGreater:
@@ -166,46 +153,74 @@ BCPSolver::BCPSolver* BCPSolver::BCPSolver::create_solver(const SolvingMethod me
         {
             throw std::invalid_argument("TwoVariablesGreater method does not support width parameter");
         }
-        return new TwoVarsGreaterMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic);
+        return new TwoVarsGreaterMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options);
     case TwoVariablesLess:
         if (!width.empty())
         {
             throw std::invalid_argument("TwoVariablesLess method does not support width parameter");
         }
-        return new TwoVarsLessMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic);
+        return new TwoVarsLessMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options);
     case OneVariableGreater:
         if (!width.empty())
         {
             throw std::invalid_argument("OneVariableGreater method does not support width parameter");
         }
-        return new OneVarGreaterMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic);
+        return new OneVarGreaterMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options);
     case OneVariableLess:
         if (!width.empty())
         {
             throw std::invalid_argument("OneVariableLess method does not support width parameter");
         }
-        return new OneVarLessMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic);
+        return new OneVarLessMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options);
     case StaircaseWithAuxiliaryVarsNoCache:
         if (width.empty())
         {
             throw std::invalid_argument("StaircaseWithAuxiliaryVarsNoCache method requires width parameter");
         }
         return new StaircaseWithAuxiliaryVarsMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic,
-                                                    false, width);
+                                                    false, width, options);
     case StaircaseWithAuxiliaryVarsWithCache:
         if (width.empty())
         {
             throw std::invalid_argument("StaircaseWithAuxiliaryVarsWithCache method requires width parameter");
         }
         return new StaircaseWithAuxiliaryVarsMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic,
-                                                    true, width);
+                                                    true, width, options);
     case StaircaseWithoutAuxiliaryVars:
         if (width.empty())
         {
             throw std::invalid_argument("StaircaseWithoutAuxiliaryVars method requires width parameter");
         }
         return new StaircaseWithoutAuxiliaryVarsMethod(graph, solver, upper_bound, use_symmetry_breaking,
-                                                       use_heuristic, width);
+                                                       use_heuristic, width, options);
+    case Portfolio:
+        if (!width.empty())
+        {
+            throw std::invalid_argument("Portfolio method chooses the width of each encoding itself");
+        }
+        if (solver != SATSolver::CADICAL)
+        {
+            throw std::invalid_argument("Portfolio method requires CaDiCaL");
+        }
+        return new PortfolioMethod(graph, upper_bound, use_symmetry_breaking, use_heuristic, options);
+    case TwoVariablesGreaterLazy:
+        if (!width.empty())
+        {
+            throw std::invalid_argument("TwoVariablesGreaterLazy method does not support width parameter");
+        }
+        if (solver != SATSolver::CADICAL)
+        {
+            throw std::invalid_argument("TwoVariablesGreaterLazy method requires CaDiCaL");
+        }
+        if (use_heuristic)
+        {
+            throw std::invalid_argument("TwoVariablesGreaterLazy method does not support the pairwise encoding");
+        }
+        if (options.cube_threads > 0 || options.probe_threads > 1)
+        {
+            throw std::invalid_argument("TwoVariablesGreaterLazy method cannot copy its propagator to other threads");
+        }
+        return new TwoVarsGreaterLazyMethod(graph, upper_bound, use_symmetry_breaking, options);
     default:
         throw std::invalid_argument("Invalid solving method");
     }
@@ -214,7 +229,9 @@ BCPSolver::BCPSolver* BCPSolver::BCPSolver::create_solver(const SolvingMethod me
 BCPSolver::SolverStatus BCPSolver::BCPSolver::non_optimal_solving(const double time_limit)
 {
     encode();
-    if (const int result = sat_solver->solve(nullptr, time_limit); result == CaDiCaL::Status::UNKNOWN)
+    seed_phases(heuristic_coloring);
+    if (const int result = solve_probe(nullptr, get_remaining_time(time_limit));
+        result == CaDiCaL::Status::UNKNOWN)
     {
         status = UNKNOWN;
         return status;
@@ -222,13 +239,29 @@ BCPSolver::SolverStatus BCPSolver::BCPSolver::non_optimal_solving(const double t
     else
     {
         status = result == CaDiCaL::Status::SATISFIABLE ? SATISFIABLE : UNSATISFIABLE;
+        if (status == SATISFIABLE)
+        {
+            store_model_coloring(*sat_solver);
+        }
         return status;
     }
 }
 
 BCPSolver::SolverStatus BCPSolver::BCPSolver::optimal_solving_non_incremental(const double time_limit)
 {
-    int result{non_optimal_solving(time_limit)};
+    int result;
+
+    // The heuristic coloring already witnesses the starting span, so the descent can begin right below it
+    if (starts_from_heuristic_coloring())
+    {
+        coloring = heuristic_coloring;
+        status = SATISFIABLE;
+        result = SATISFIABLE;
+    }
+    else
+    {
+        result = non_optimal_solving(time_limit);
+    }
 
     if (result == UNKNOWN)
     {
@@ -242,110 +275,598 @@ BCPSolver::SolverStatus BCPSolver::BCPSolver::optimal_solving_non_incremental(co
         return status;
     }
 
-    while (result == SATISFIABLE || result == CaDiCaL::Status::SATISFIABLE && span > lower_bound)
+    return search_optimal_span(time_limit, [&](const double slice)
     {
         sat_solver->reset();
-        span--;
         encode();
+        seed_phases(coloring);
+        return solve_probe(nullptr, std::min(slice, get_remaining_time(time_limit)));
+    });
+}
 
-        if (time_limit == NO_TIME_LIMIT)
+BCPSolver::SolverStatus BCPSolver::BCPSolver::optimal_solving_incremental(
+    const double time_limit, const std::string& variable_for_incremental)
+{
+    int result;
+
+    if (starts_from_heuristic_coloring())
+    {
+        encode();
+        coloring = heuristic_coloring;
+        status = SATISFIABLE;
+        result = SATISFIABLE;
+    }
+    else
+    {
+        result = non_optimal_solving(time_limit);
+    }
+
+    if (result == UNKNOWN)
+    {
+        status = UNKNOWN;
+        return status;
+    }
+
+    if (result == UNSATISFIABLE)
+    {
+        status = UNSATISFIABLE;
+        return status;
+    }
+
+    // Every probe runs on this encoding; the probed span is imposed through assumptions only
+    encoded_span = span;
+    int committed_span = encoded_span;
+
+    if (options.probe_threads > 1)
+    {
+        return probe_concurrently(time_limit, variable_for_incremental);
+    }
+
+    return search_optimal_span(time_limit, [&](const double slice)
+    {
+        // No probe goes above the best coloring found so far, so its bound can become permanent. This waits for the
+        // next probe because adding clauses discards the model the coloring is read from.
+        if (const int best = get_coloring_span(coloring); best < committed_span)
         {
-            result = sat_solver->solve();
-            if (result != CaDiCaL::Status::SATISFIABLE)
+            const auto units{create_assumptions(variable_for_incremental, best)};
+            for (const auto lit : *units)
             {
-                span++;
+                sat_solver->add_clause(lit);
             }
+            delete units;
+            committed_span = best;
         }
-        else
+
+        seed_phases(coloring);
+        const auto assumptions{create_assumptions(variable_for_incremental, span)};
+        const int probe_result = solve_probe(assumptions, slice);
+        delete assumptions;
+        return probe_result;
+    });
+}
+
+BCPSolver::SolverStatus BCPSolver::BCPSolver::search_optimal_span(const double time_limit,
+                                                                  const std::function<int(double)>& probe)
+{
+    // The model of the first solve may already use fewer colors than the span it was asked for
+    SpanSearch search(options.search_strategy, lower_bound, coloring.empty() ? span : get_coloring_span(coloring));
+    bool undivided = false;
+
+    while (true)
+    {
+        import_shared_bounds(search);
+        if (search.done())
+        {
+            // Spans whose probe ran out of its slice get another try with all the time that is left
+            if (search.is_optimal() || time_limit == NO_TIME_LIMIT || undivided)
+            {
+                break;
+            }
+            search.retry_unresolved();
+            undivided = true;
+        }
+
+        const double remaining_time = get_remaining_time(time_limit);
+        double slice = NO_TIME_LIMIT;
+        if (time_limit != NO_TIME_LIMIT)
+        {
+            if (remaining_time <= 0)
+            {
+                break;
+            }
+            slice = undivided ? remaining_time : remaining_time / search.estimated_probes();
+        }
+
+        span = search.next();
+        const double solving_time = sat_solver->get_statistics()["total_solving_time"];
+        probing = true;
+        const int result = probe(slice);
+        probing = false;
+
+        // A model usually leaves the top colors unused; after compaction the search continues below its real span
+        if (result == CaDiCaL::Status::SATISFIABLE)
         {
-            const auto remaining_time = time_limit - encoding_time - sat_solver->get_statistics()["total_solving_time"];
-            result = sat_solver->solve(nullptr, remaining_time);
+            store_model_coloring(*sat_solver);
+            span = get_coloring_span(coloring);
+        }
 
-            if (result != CaDiCaL::Status::SATISFIABLE)
+        if (shared_bounds != nullptr)
+        {
+            if (result == CaDiCaL::Status::SATISFIABLE)
+            {
+                shared_bounds->offer_span(span);
+            }
+            else if (result == CaDiCaL::Status::UNSATISFIABLE)
             {
-                span++;
+                shared_bounds->offer_lower_bound(span + 1);
+            }
+            else if (shared_bounds->settles(span))
+            {
+                // Interrupted because another worker answered this span; the next import records the answer
+                continue;
             }
         }
+
+        search.record(span, from_sat_status(result), sat_solver->get_statistics()["total_solving_time"] - solving_time,
+                      remaining_time);
     }
 
-    status = result != CaDiCaL::Status::UNKNOWN ? OPTIMAL : SATISFIABLE;
+    span = search.get_feasible();
+    status = search.is_optimal() ? OPTIMAL : SATISFIABLE;
     return status;
 }
 
-BCPSolver::SolverStatus BCPSolver::BCPSolver::optimal_solving_incremental(
-    const double time_limit, const std::string& variable_for_incremental)
+BCPSolver::SolverStatus BCPSolver::BCPSolver::probe_concurrently(const double time_limit,
+                                                                 const std::string& variable_for_incremental)
 {
-    int result{non_optimal_solving(time_limit)};
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Creates the activation literals up front, so the workers only ever read the encoding
+    delete create_assumptions(variable_for_incremental, encoded_span - 1);
+    seed_phases(coloring);
+
+    std::vector<std::unique_ptr<SATSolver::SatSolver>> copies;
+    const auto exchange = options.shared_clause_size > 0
+                              ? std::make_unique<SATSolver::ClauseExchange>(
+                                  options.shared_clause_size, sat_solver->get_number_of_variables())
+                              : nullptr;
+    for (int k = 0; k < options.probe_threads; k++)
+    {
+        copies.push_back(sat_solver->clone());
+        copies.back()->share_clauses(exchange.get(), k);
+    }
 
-    if (result == UNKNOWN)
+    SharedBounds bounds(get_coloring_span(coloring), lower_bound);
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::set<int> in_flight;
+    std::atomic<bool> stopped{false};
+    std::exception_ptr failure;
+
+    // Spans s-1, s-2, s-4, ... below the best span s, then any other span of the window no worker holds
+    const auto next_target = [&]
     {
-        status = UNKNOWN;
-        return status;
+        const int best = bounds.get_best_span();
+        const int low = bounds.get_lower_bound();
+        for (int step = 1; best - step >= low; step *= 2)
+        {
+            if (!in_flight.contains(best - step))
+            {
+                return best - step;
+            }
+        }
+        for (int target = best - 1; target >= low; target--)
+        {
+            if (!in_flight.contains(target))
+            {
+                return target;
+            }
+        }
+        return 0;
+    };
+
+    const auto work = [&](SATSolver::SatSolver& solver)
+    {
+        int committed_span = encoded_span;
+        std::unique_lock lock(mutex);
+        while (!stopped && !bounds.is_optimal())
+        {
+            const int target = next_target();
+            if (target == 0)
+            {
+                changed.wait(lock);
+                continue;
+            }
+            in_flight.insert(target);
+            const int best = bounds.get_best_span();
+            lock.unlock();
+
+            // Like the sequential incremental search, spans at or above the best coloring are cut off for good
+            if (best < committed_span)
+            {
+                const auto units{create_assumptions(variable_for_incremental, best)};
+                for (const auto lit : *units)
+                {
+                    solver.add_clause(lit);
+                }
+                delete units;
+                committed_span = best;
+            }
+
+            solver.set_interrupt([&bounds, &stopped, target]
+            {
+                return stopped.load(std::memory_order_relaxed) || bounds.settles(target);
+            });
+            const auto assumptions{create_assumptions(variable_for_incremental, target)};
+            const int result = solver.solve(assumptions, get_remaining_time(time_limit));
+            delete assumptions;
+
+            lock.lock();
+            in_flight.erase(target);
+            if (result == CaDiCaL::Status::SATISFIABLE)
+            {
+                store_model_coloring(solver);
+                bounds.offer_span(get_coloring_span(coloring));
+            }
+            else if (result == CaDiCaL::Status::UNSATISFIABLE)
+            {
+                bounds.offer_lower_bound(target + 1);
+            }
+            else if (!bounds.settles(target))
+            {
+                // Out of time
+                stopped = true;
+            }
+            changed.notify_all();
+        }
+        changed.notify_all();
+    };
+
+    std::vector<std::thread> threads;
+    for (const auto& copy : copies)
+    {
+        threads.emplace_back([&, solver = copy.get()]
+        {
+            try
+            {
+                work(*solver);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(mutex);
+                if (!failure)
+                {
+                    failure = std::current_exception();
+                }
+                stopped = true;
+                changed.notify_all();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
     }
 
-    if (result == UNSATISFIABLE)
+    for (const auto& copy : copies)
     {
-        status = UNSATISFIABLE;
-        return status;
+        sat_solver->absorb_solves(*copy);
+    }
+    concurrent_probe_time += std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start_time).count();
+    if (failure)
+    {
+        std::rethrow_exception(failure);
     }
 
-    while (result == SATISFIABLE || result == CaDiCaL::Status::SATISFIABLE && span > lower_bound)
+    span = get_coloring_span(coloring);
+    status = bounds.is_optimal() ? OPTIMAL : SATISFIABLE;
+    return status;
+}
+
+void BCPSolver::BCPSolver::import_shared_bounds(SpanSearch& search) const
+{
+    if (shared_bounds == nullptr)
     {
-        const auto assumptions{create_assumptions(variable_for_incremental)};
+        return;
+    }
 
-        for (const auto lit : *assumptions)
+    if (const int best = shared_bounds->get_best_span(); best < search.get_feasible())
+    {
+        search.record(best, SATISFIABLE, 0, NO_TIME_LIMIT);
+    }
+    if (const int bound = shared_bounds->get_lower_bound(); bound - 1 > search.get_infeasible())
+    {
+        search.record(bound - 1, UNSATISFIABLE, 0, NO_TIME_LIMIT);
+    }
+}
+
+double BCPSolver::BCPSolver::get_remaining_time(const double time_limit) const
+{
+    if (time_limit == NO_TIME_LIMIT)
+    {
+        return NO_TIME_LIMIT;
+    }
+    return SATSolver::Deadline::global().remaining();
+}
+
+int BCPSolver::BCPSolver::x_color_limit(const int limit)
+{
+    if (limit >= encoded_span)
+    {
+        return 0;
+    }
+
+    // color_activations[c] forbids color c and, through the chain, every color above it
+    if (color_activations.empty())
+    {
+        const int first = sat_solver->create_new_variables(encoded_span);
+        color_activations.assign(encoded_span + 1, 0);
+        for (int c = 1; c <= encoded_span; c++)
         {
-            sat_solver->add_clause(lit);
+            color_activations[c] = first + c - 1;
         }
 
-        if (time_limit == NO_TIME_LIMIT)
+        for (int c = 1; c <= encoded_span; c++)
         {
-            // result = sat_solver.solve(assumptions);
-            result = sat_solver->solve();
-            if (result == CaDiCaL::Status::SATISFIABLE)
+            for (int i = 0; i < graph->get_number_of_nodes(); i++)
+            {
+                sat_solver->add_clause(-color_activations[c], -x(i, c));
+            }
+            if (c < encoded_span)
             {
-                span--;
+                sat_solver->add_clause(-color_activations[c], color_activations[c + 1]);
             }
         }
+    }
+
+    return color_activations[limit + 1];
+}
+
+BCPSolver::SolverStatus BCPSolver::BCPSolver::solve(const double time_limit, const bool find_optimal,
+                                                    const bool incremental, const std::string& variable_for_incremental)
+{
+    // From here on the time limit covers encoding as well as solving. A deadline armed before the solver was created
+    // also covers the bound stages and is left to the caller.
+    auto& deadline = SATSolver::Deadline::global();
+    const bool arms_deadline = !deadline.armed();
+    if (arms_deadline)
+    {
+        deadline.arm(time_limit);
+    }
+    solve_until_deadline(time_limit, find_optimal, incremental, variable_for_incremental);
+    if (arms_deadline)
+    {
+        deadline.disarm();
+    }
+    return status;
+}
+
+BCPSolver::SolverStatus BCPSolver::BCPSolver::solve_until_deadline(const double time_limit, const bool find_optimal,
+                                                                   const bool incremental,
+                                                                   const std::string& variable_for_incremental)
+{
+    try
+    {
+        if (!find_optimal)
+        {
+            non_optimal_solving(time_limit);
+        }
+        else if (!incremental)
+        {
+            optimal_solving_non_incremental(time_limit);
+        }
+        else
+        {
+            optimal_solving_incremental(time_limit, variable_for_incremental);
+        }
+    }
+    catch (const SATSolver::DeadlineExpired&)
+    {
+        // The time ran out in the middle of an encoding; the best coloring found so far still stands
+        if (coloring.empty())
+        {
+            status = UNKNOWN;
+        }
         else
         {
-            const auto remaining_time = time_limit - encoding_time - sat_solver->get_statistics()["total_solving_time"];
-            // result = sat_solver.solve(assumptions, remaining_time);
-            result = sat_solver->solve(nullptr, remaining_time);
+            span = get_coloring_span(coloring);
+            status = SATISFIABLE;
+        }
+    }
+    return status;
+}
 
-            if (result == CaDiCaL::Status::SATISFIABLE)
+std::vector<int> BCPSolver::BCPSolver::decode_coloring(const SATSolver::SatSolver& model) const
+{
+    std::vector colors(graph->get_number_of_nodes(), 0);
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
+    {
+        for (int c = 1; c <= x.get_number_of_colors(); c++)
+        {
+            if (model.value(x(i, c)) > 0)
             {
-                span--;
+                colors[i] = c;
+                break;
             }
         }
-        delete assumptions;
     }
+    return colors;
+}
 
-    status = result != CaDiCaL::Status::UNKNOWN ? OPTIMAL : SATISFIABLE;
-    return status;
+void BCPSolver::BCPSolver::store_model_coloring(const SATSolver::SatSolver& model)
+{
+    const auto decoded = decode_coloring(model);
+    if (!is_valid_coloring(*graph, decoded))
+    {
+        throw std::logic_error("The SAT model does not decode to a valid coloring");
+    }
+
+    if (auto compacted = compact_coloring(*graph, decoded);
+        coloring.empty() || get_coloring_span(compacted) < get_coloring_span(coloring))
+    {
+        coloring = std::move(compacted);
+    }
 }
 
-BCPSolver::SolverStatus BCPSolver::BCPSolver::solve(const double time_limit, const bool find_optimal,
-                                                    const bool incremental, const std::string& variable_for_incremental)
+void BCPSolver::BCPSolver::set_coloring_phases(const std::vector<int>& colors)
 {
-    if (!find_optimal)
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
     {
-        return non_optimal_solving(time_limit);
+        for (int c = 1; c <= x.get_number_of_colors(); c++)
+        {
+            sat_solver->set_phase(c == colors[i] ? x(i, c) : -x(i, c));
+        }
     }
-    else
+}
+
+void BCPSolver::BCPSolver::seed_phases(const std::vector<int>& colors)
+{
+    if (!options.phase_seeding || colors.empty())
     {
-        if (!incremental)
+        return;
+    }
+
+    std::vector<int> hint(colors.size());
+    std::transform(colors.begin(), colors.end(), hint.begin(), [this](const int c) { return std::min(c, span); });
+    set_coloring_phases(hint);
+}
+
+std::vector<int> BCPSolver::BCPSolver::color_range_literals(const int node, const int low, const int high) const
+{
+    std::vector<int> literals;
+    for (int c = 1; c <= x.get_number_of_colors(); c++)
+    {
+        if (c < low || c > high)
         {
-            return optimal_solving_non_incremental(time_limit);
+            literals.push_back(-x(node, c));
         }
+    }
+    return literals;
+}
 
-        else
+std::vector<std::vector<int>> BCPSolver::BCPSolver::create_cubes(const int count) const
+{
+    std::vector<std::vector<int>> cubes{{}};
+    for (const int node : graph->get_degree_order())
+    {
+        const int parts = std::min(span, (count + static_cast<int>(cubes.size()) - 1) / static_cast<int>(cubes.size()));
+        if (parts < 2)
+        {
+            break;
+        }
+
+        std::vector<std::vector<int>> split;
+        for (const auto& cube : cubes)
+        {
+            for (int p = 0; p < parts; p++)
+            {
+                auto literals = color_range_literals(node, 1 + p * span / parts, (p + 1) * span / parts);
+                literals.insert(literals.begin(), cube.begin(), cube.end());
+                split.push_back(std::move(literals));
+            }
+        }
+        cubes = std::move(split);
+    }
+    return cubes;
+}
+
+int BCPSolver::BCPSolver::solve_probe(const std::vector<int>* assumptions, const double time_limit)
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    while (true)
+    {
+        double slice = NO_TIME_LIMIT;
+        if (time_limit != NO_TIME_LIMIT)
+        {
+            slice = time_limit - std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start_time).count();
+        }
+
+        const int result = options.cube_threads == 0
+                               ? sat_solver->solve(assumptions, slice)
+                               : sat_solver->solve_cubes(create_cubes(options.cube_threads * CUBES_PER_THREAD),
+                                                         options.cube_threads, assumptions, slice);
+
+        // Leaving edges out only relaxes the formula, so UNSAT stands; a model stands once it violates no edge
+        if (result != CaDiCaL::Status::SATISFIABLE || !options.cegar || refine_violated_edges() == 0)
         {
-            return optimal_solving_incremental(time_limit, variable_for_incremental);
+            return result;
         }
     }
 }
 
+void BCPSolver::BCPSolver::encode_edges()
+{
+    const auto& edges = graph->get_edges();
+    if (edge_selected.empty())
+    {
+        edge_selected.assign(edges.size(), !options.cegar);
+        if (options.cegar)
+        {
+            std::vector in_clique(graph->get_number_of_nodes(), false);
+            for (const int node : lower_bound_clique)
+            {
+                in_clique[node] = true;
+            }
+            for (std::size_t e = 0; e < edges.size(); e++)
+            {
+                const auto& [u, v, weight] = edges[e];
+                edge_selected[e] = 2 * weight > graph->get_max_weight() || (in_clique[u] && in_clique[v]);
+            }
+        }
+    }
+
+    edge_encoding_span = span;
+    for (std::size_t e = 0; e < edges.size(); e++)
+    {
+        if (edge_selected[e])
+        {
+            const auto& [u, v, weight] = edges[e];
+            encode_edge(u, v, weight);
+        }
+    }
+}
+
+int BCPSolver::BCPSolver::refine_violated_edges()
+{
+    if (edge_selected.empty())
+    {
+        return 0;
+    }
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const auto colors = decode_coloring(*sat_solver);
+    const auto& edges = graph->get_edges();
+
+    // The clauses go into the formula as it was encoded, whatever span is being probed
+    const int probed_span = span;
+    span = edge_encoding_span;
+    int violated = 0;
+    for (std::size_t e = 0; e < edges.size(); e++)
+    {
+        if (const auto& [u, v, weight] = edges[e]; !edge_selected[e] && std::abs(colors[u] - colors[v]) < weight)
+        {
+            edge_selected[e] = true;
+            encode_edge(u, v, weight);
+            violated++;
+        }
+    }
+    span = probed_span;
+
+    if (violated > 0)
+    {
+        cegar_rounds++;
+    }
+    encoding_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+    return violated;
+}
+
+std::vector<int> BCPSolver::BCPSolver::get_coloring() const
+{
+    return get_span() < 0 ? std::vector<int>{} : coloring;
+}
+
 int BCPSolver::BCPSolver::get_span() const
 {
     return (status != UNKNOWN && status != UNSATISFIABLE) ? span : -1;
@@ -358,11 +879,23 @@ std::unordered_map<std::string, double> BCPSolver::BCPSolver::get_statistics() c
     stats["V"] = graph->get_number_of_nodes();
     stats["E"] = graph->get_number_of_edges();
     stats["upper_bound"] = upper_bound;
+    stats["upper_bound_time"] = upper_bound_time;
+    stats["lower_bound"] = lower_bound;
+    stats["lower_bound_time"] = lower_bound_time;
+    stats["upper_bound_variant"] = upper_bound_variant;
+    stats["upper_bound_starts"] = upper_bound_starts;
+    stats["tabu_iterations"] = static_cast<double>(tabu_iterations);
     stats["status"] = status;
     stats["span"] = get_span();
     stats["encoding_time"] = encoding_time;
+    stats["concurrent_probe_time"] = concurrent_probe_time;
+    if (options.cegar)
+    {
+        stats["cegar_rounds"] = cegar_rounds;
+        stats["cegar_edges"] = static_cast<double>(std::count(edge_selected.begin(), edge_selected.end(), true));
+    }
 
-    stats["time_used"] = encoding_time + stats["total_solving_time"];
+    stats["time_used"] = encoding_time + stats["total_solving_time"] + concurrent_probe_time;
 
     return stats;
 }
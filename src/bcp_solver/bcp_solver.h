@@ -5,13 +5,19 @@
 #ifndef BCP_BMCP_BCP_SOLVER_H
 #define BCP_BMCP_BCP_SOLVER_H
 #include "../sat_solver/SatSolver.h"
+#include "shared_bounds.h"
 #include "utility.h"
+#include "variable_table.h"
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <utility>
 
 namespace BCPSolver
 {
+    class SpanSearch;
+
     class BCPSolver
     {
     protected:
@@ -24,26 +30,117 @@ namespace BCPSolver
         SolverStatus status{UNKNOWN};
 
         double encoding_time{};
+        // Wall-clock time spent probing spans concurrently
+        double concurrent_probe_time{};
+        double upper_bound_time{};
+        double lower_bound_time{};
+        int upper_bound_variant{-1};
+        int upper_bound_starts{};
+        long long tabu_iterations{};
         bool use_symmetry_breaking;
         bool use_heuristic;
+        SolverOptions options;
+
+        // Coloring found while computing the upper bound; empty when the upper bound was given.
+        std::vector<int> heuristic_coloring{};
+        // Best coloring known so far
+        std::vector<int> coloring{};
+
+        // Bounds exchanged with the other workers when running inside a portfolio
+        SharedBounds* shared_bounds{};
+        // Set while a span probe is running
+        bool probing{false};
 
         void calculate_upper_bound();
 
+        void calculate_lower_bound();
+
+        [[nodiscard]] bool starts_from_heuristic_coloring() const;
+
         // Vertex u has color i
-        std::map<std::pair<int, int>, int> x{};
+        VariableTable x{};
         // Vertex u has color greater or equal to i || Vertex u has color less or equal to i
-        std::map<std::pair<int, int>, int> y{};
+        VariableTable y{};
 
         int span{};
+        // Span the formula was encoded with; in incremental mode smaller spans are probed through assumptions
+        int encoded_span{};
+        std::vector<int> color_activations{};
+
+        // Literal that restricts the x variables to colors 1..limit when assumed, 0 when nothing is cut off. The
+        // activation variables are created on first use.
+        int x_color_limit(int limit);
 
         virtual void create_variable() =0;
 
         virtual void encode() =0;
 
-        virtual std::vector<int>* create_assumptions(const std::string& variable_for_incremental) =0;
+        // Distance clauses of one edge on the span the variables were created for
+        virtual void encode_edge(int u, int v, int weight) =0;
+
+        // Edges whose clauses are in the formula, by index in get_edges(); with CEGAR only those found necessary
+        std::vector<bool> edge_selected{};
+        // Span encode_edges() last encoded with
+        int edge_encoding_span{};
+        // Clique behind the lower bound
+        std::vector<int> lower_bound_clique{};
+        int cegar_rounds{};
+
+        // Encodes the selected edges; with CEGAR the first call selects the heavy edges and those of the clique
+        void encode_edges();
+
+        // Adds the edges the model violates to the formula and returns how many there were
+        int refine_violated_edges();
+
+        // Literals restricting the vertices to colors 1..limit on the formula encoded with encoded_span
+        virtual std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) =0;
+
+        // Coloring in the model of the solver's last satisfiable solve. Reads x by default.
+        [[nodiscard]] virtual std::vector<int> decode_coloring(const SATSolver::SatSolver& model) const;
+
+        // Decodes the model, compacts it and keeps it when it beats the stored coloring.
+        void store_model_coloring(const SATSolver::SatSolver& model);
+
+        // Sets the decision phases of the encoded variables to the coloring; colors already fit in 1..span. Sets x by
+        // default.
+        virtual void set_coloring_phases(const std::vector<int>& colors);
+
+        // Warm-starts the next solve from the coloring, lowering colors above the span to it
+        void seed_phases(const std::vector<int>& colors);
+
+        // Literals confining the vertex to colors low..high. Uses x by default.
+        [[nodiscard]] virtual std::vector<int> color_range_literals(int node, int low, int high) const;
+
+        // About count cubes splitting colors 1..span of the highest degree vertices into ranges; every coloring
+        // satisfies exactly one of them.
+        [[nodiscard]] std::vector<std::vector<int>> create_cubes(int count) const;
+
+        // Solves the current span, split into cubes when cube threads are enabled
+        int solve_probe(const std::vector<int>* assumptions, double time_limit);
+
+        // Probes spans chosen by the search strategy until the bounds meet or the time runs out. The probe callback
+        // receives the time slice for the current span and returns the SAT solver result.
+        SolverStatus search_optimal_span(double time_limit, const std::function<int(double)>& probe);
+
+        // Probes several spans below the best coloring at once, each on its own copy of the incremental encoding.
+        // A finished worker takes the next span of the shrinking window; probes the bounds settle are interrupted.
+        SolverStatus probe_concurrently(double time_limit, const std::string& variable_for_incremental);
+
+        // Tightens the search with the bounds the other portfolio workers found
+        void import_shared_bounds(SpanSearch& search) const;
+
+        // Runs the requested kind of solving under the already armed deadline
+        virtual SolverStatus solve_until_deadline(double time_limit, bool find_optimal, bool incremental,
+                                                  const std::string& variable_for_incremental);
+
+        [[nodiscard]] double get_remaining_time(double time_limit) const;
 
         explicit BCPSolver(const Graph* graph, SATSolver::SOLVER solver, int upper_bound,
-                           bool use_symmetry_breaking, bool use_heuristic);
+                           bool use_symmetry_breaking, bool use_heuristic, const SolverOptions& options);
+
+        friend class PortfolioMethod;
+        friend class ComponentMethod;
+        friend class KernelMethod;
 
     public:
         BCPSolver(const BCPSolver& other) = delete;
@@ -56,7 +153,8 @@ namespace BCPSolver
                                         SATSolver::SOLVER solver = SATSolver::CADICAL,
                                         int upper_bound = -1,
                                         bool use_symmetry_breaking = true,
-                                        bool use_heuristic = false, const std::string& width = "");
+                                        bool use_heuristic = false, const std::string& width = "",
+                                        const SolverOptions& options = {});
 
         SolverStatus non_optimal_solving(double time_limit);
 
@@ -69,7 +167,10 @@ namespace BCPSolver
 
         [[nodiscard]] int get_span() const;
 
-        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const;
+        // Coloring witnessing get_span() with colors 1..get_span(); empty when no coloring was found.
+        [[nodiscard]] std::vector<int> get_coloring() const;
+
+        [[nodiscard]] virtual std::unordered_map<std::string, double> get_statistics() const;
     };
 } // namespace BCPSolver
 
@@ -0,0 +1,180 @@
+#include "CliqueLowerBound.h"
+
+#include <algorithm>
+#include <limits>
+
+BCPSolver::CliqueLowerBound::CliqueLowerBound(const Graph* graph) : graph(graph)
+{
+}
+
+void BCPSolver::CliqueLowerBound::load_weights(const std::vector<int>& clique)
+{
+    const int k = static_cast<int>(clique.size());
+    weights.assign(k * k, 0);
+    for (int i = 0; i < k; i++)
+    {
+        for (int j = i + 1; j < k; j++)
+        {
+            weights[i * k + j] = weights[j * k + i] = graph->get_weight(clique[i], clique[j]);
+        }
+    }
+}
+
+int BCPSolver::CliqueLowerBound::greedy_path(const int k) const
+{
+    // Nearest neighbor path from vertex 0; any Hamiltonian path is an upper bound on the shortest one
+    std::vector visited(k, false);
+    visited[0] = true;
+    int current = 0;
+    int length = 0;
+    for (int step = 1; step < k; step++)
+    {
+        int next = -1;
+        for (int j = 0; j < k; j++)
+        {
+            if (!visited[j] && (next < 0 || weights[current * k + j] < weights[current * k + next]))
+            {
+                next = j;
+            }
+        }
+        visited[next] = true;
+        length += weights[current * k + next];
+        current = next;
+    }
+    return length;
+}
+
+int BCPSolver::CliqueLowerBound::shortest_path(const int k) const
+{
+    // Held-Karp: length[mask * k + last] is the shortest path visiting mask and ending at last
+    constexpr int INF = std::numeric_limits<int>::max() / 2;
+    const int full = 1 << k;
+    std::vector length(static_cast<std::size_t>(full) * k, INF);
+    for (int i = 0; i < k; i++)
+    {
+        length[(1 << i) * k + i] = 0;
+    }
+
+    for (int mask = 1; mask < full; mask++)
+    {
+        for (int last = 0; last < k; last++)
+        {
+            const int current = length[static_cast<std::size_t>(mask) * k + last];
+            if (current == INF)
+            {
+                continue;
+            }
+            for (int next = 0; next < k; next++)
+            {
+                if (mask & 1 << next)
+                {
+                    continue;
+                }
+                int& target = length[static_cast<std::size_t>(mask | 1 << next) * k + next];
+                target = std::min(target, current + weights[last * k + next]);
+            }
+        }
+    }
+
+    const auto* row = length.data() + static_cast<std::size_t>(full - 1) * k;
+    return *std::min_element(row, row + k);
+}
+
+int BCPSolver::CliqueLowerBound::spanning_tree(const int k) const
+{
+    // Prim on the complete clique graph; a Hamiltonian path is a spanning tree, so it is never lighter than this
+    constexpr int INF = std::numeric_limits<int>::max();
+    std::vector in_tree(k, false);
+    std::vector distance(k, INF);
+    distance[0] = 0;
+    int total = 0;
+    for (int step = 0; step < k; step++)
+    {
+        int next = -1;
+        for (int j = 0; j < k; j++)
+        {
+            if (!in_tree[j] && (next < 0 || distance[j] < distance[next]))
+            {
+                next = j;
+            }
+        }
+        in_tree[next] = true;
+        total += distance[next];
+        for (int j = 0; j < k; j++)
+        {
+            if (!in_tree[j])
+            {
+                distance[j] = std::min(distance[j], weights[next * k + j]);
+            }
+        }
+    }
+    return total;
+}
+
+void BCPSolver::CliqueLowerBound::evaluate(const std::vector<int>& clique)
+{
+    const int k = static_cast<int>(clique.size());
+    load_weights(clique);
+
+    // Skip cliques that cannot beat the current bound
+    if (1 + greedy_path(k) <= best_bound)
+    {
+        return;
+    }
+
+    if (const int bound = 1 + (k <= EXACT_PATH_LIMIT ? shortest_path(k) : spanning_tree(k)); bound > best_bound)
+    {
+        best_bound = bound;
+        best_clique = clique;
+    }
+}
+
+int BCPSolver::CliqueLowerBound::run()
+{
+    const int n = graph->get_number_of_nodes();
+    best_bound = n > 0 ? 1 : 0;
+    best_clique.assign(n > 0 ? 1 : 0, 0);
+
+    std::vector<int> clique;
+    std::vector<int> candidates;
+    std::vector<int> gains;
+
+    for (const int start : graph->get_degree_order())
+    {
+        // Candidates are the common neighbors of the clique, gains their total weight to it
+        clique.assign(1, start);
+        const auto neighbors = graph->get_neighbors(start);
+        const auto neighbor_weights = graph->get_neighbor_weights(start);
+        candidates.assign(neighbors.begin(), neighbors.end());
+        gains.assign(neighbor_weights.begin(), neighbor_weights.end());
+
+        while (!candidates.empty())
+        {
+            const auto best = std::max_element(gains.begin(), gains.end()) - gains.begin();
+            const int chosen = candidates[best];
+            clique.push_back(chosen);
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < candidates.size(); i++)
+            {
+                if (const int w = graph->get_weight(chosen, candidates[i]); w > 0)
+                {
+                    candidates[kept] = candidates[i];
+                    gains[kept] = gains[i] + w;
+                    kept++;
+                }
+            }
+            candidates.resize(kept);
+            gains.resize(kept);
+        }
+
+        evaluate(clique);
+    }
+
+    return best_bound;
+}
+
+const std::vector<int>& BCPSolver::CliqueLowerBound::get_clique() const
+{
+    return best_clique;
+}
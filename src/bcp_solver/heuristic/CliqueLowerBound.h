@@ -0,0 +1,49 @@
+#ifndef BCP_CLIQUELOWERBOUND_H
+#define BCP_CLIQUELOWERBOUND_H
+
+#include <vector>
+
+#include "bcp_solver/utility.h"
+
+namespace BCPSolver
+{
+    // Lower bound on the span from heavy cliques. The vertices of a clique get pairwise distinct colors, so sorting
+    // them by color gives a Hamiltonian path whose consecutive gaps are at least the edge weights: the clique needs a
+    // span of at least 1 + the weight of its shortest Hamiltonian path.
+    //
+    // Cliques are grown greedily from every vertex, always adding the common neighbor with the largest total weight
+    // to the clique. The path is solved exactly by Held-Karp for cliques of up to EXACT_PATH_LIMIT vertices and
+    // bounded by the minimum spanning tree of the clique otherwise.
+    class CliqueLowerBound
+    {
+    private:
+        static constexpr int EXACT_PATH_LIMIT = 12;
+
+        const Graph* graph;
+
+        std::vector<int> best_clique;
+        int best_bound{};
+
+        std::vector<int> weights;
+
+        void load_weights(const std::vector<int>& clique);
+
+        [[nodiscard]] int greedy_path(int k) const;
+
+        [[nodiscard]] int shortest_path(int k) const;
+
+        [[nodiscard]] int spanning_tree(int k) const;
+
+        void evaluate(const std::vector<int>& clique);
+
+    public:
+        explicit CliqueLowerBound(const Graph* graph);
+
+        [[nodiscard]] int run();
+
+        // Clique that gave the bound
+        [[nodiscard]] const std::vector<int>& get_clique() const;
+    };
+} // namespace BCPSolver
+
+#endif //BCP_CLIQUELOWERBOUND_H
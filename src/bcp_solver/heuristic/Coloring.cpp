@@ -0,0 +1,78 @@
+#include "Coloring.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+int BCPSolver::first_fit_color(const Graph& graph, const std::vector<int>& colors, const int node,
+                               std::vector<std::pair<int, int>>& intervals)
+{
+    intervals.clear();
+
+    const auto neighbors = graph.get_neighbors(node);
+    const auto weights = graph.get_neighbor_weights(node);
+    for (std::size_t k = 0; k < neighbors.size(); k++)
+    {
+        if (const int neighbor_color = colors[neighbors[k]]; neighbor_color > 0)
+        {
+            // Colors strictly inside (neighbor_color - w, neighbor_color + w) are forbidden
+            intervals.emplace_back(neighbor_color - weights[k], neighbor_color + weights[k]);
+        }
+    }
+
+    std::sort(intervals.begin(), intervals.end());
+
+    int color = 1;
+    for (const auto& [low, high] : intervals)
+    {
+        if (color <= low)
+        {
+            break;
+        }
+        color = std::max(color, high);
+    }
+    return color;
+}
+
+std::vector<int> BCPSolver::greedy_coloring(const Graph& graph, const std::vector<int>& order)
+{
+    std::vector colors(graph.get_number_of_nodes(), 0);
+    std::vector<std::pair<int, int>> intervals;
+    for (const int node : order)
+    {
+        colors[node] = first_fit_color(graph, colors, node, intervals);
+    }
+    return colors;
+}
+
+std::vector<int> BCPSolver::compact_coloring(const Graph& graph, const std::vector<int>& colors)
+{
+    std::vector<int> order(colors.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](const int a, const int b) { return colors[a] < colors[b]; });
+    return greedy_coloring(graph, order);
+}
+
+int BCPSolver::get_coloring_span(const std::vector<int>& colors)
+{
+    return colors.empty() ? 0 : *std::max_element(colors.begin(), colors.end());
+}
+
+bool BCPSolver::is_valid_coloring(const Graph& graph, const std::vector<int>& colors)
+{
+    if (static_cast<int>(colors.size()) != graph.get_number_of_nodes())
+    {
+        return false;
+    }
+
+    if (std::any_of(colors.begin(), colors.end(), [](const int c) { return c < 1; }))
+    {
+        return false;
+    }
+
+    return std::all_of(graph.get_edges().begin(), graph.get_edges().end(), [&](const auto& edge)
+    {
+        const auto& [u, v, w] = edge;
+        return std::abs(colors[u] - colors[v]) >= w;
+    });
+}
@@ -0,0 +1,30 @@
+#ifndef BCP_COLORING_H
+#define BCP_COLORING_H
+
+#include <utility>
+#include <vector>
+
+#include "bcp_solver/utility.h"
+
+namespace BCPSolver
+{
+    // Colorings are indexed by vertex and use colors 1..span; 0 marks an uncolored vertex.
+
+    // Smallest color c >= 1 with |c - colors[w]| >= weight(node, w) for every colored neighbor w. The interval
+    // buffer is scratch space that callers reuse between calls.
+    int first_fit_color(const Graph& graph, const std::vector<int>& colors, int node,
+                        std::vector<std::pair<int, int>>& intervals);
+
+    // Colors the vertices one by one in the given order, each with its first fit color.
+    [[nodiscard]] std::vector<int> greedy_coloring(const Graph& graph, const std::vector<int>& order);
+
+    // Recolors the vertices by first fit in order of their current color. No vertex moves up: everything colored
+    // before a vertex sits at most at its old color, so the old color stays compatible.
+    [[nodiscard]] std::vector<int> compact_coloring(const Graph& graph, const std::vector<int>& colors);
+
+    [[nodiscard]] int get_coloring_span(const std::vector<int>& colors);
+
+    [[nodiscard]] bool is_valid_coloring(const Graph& graph, const std::vector<int>& colors);
+} // namespace BCPSolver
+
+#endif //BCP_COLORING_H
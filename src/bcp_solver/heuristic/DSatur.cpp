@@ -0,0 +1,148 @@
+#include "DSatur.h"
+
+#include <algorithm>
+
+#include "Coloring.h"
+
+BCPSolver::DSatur::DSatur(const Graph* graph) : graph(graph)
+{
+}
+
+BCPSolver::DSatur::DSatur(const Graph* graph, std::vector<int> order) : graph(graph), order(std::move(order))
+{
+}
+
+void BCPSolver::DSatur::sift_up(std::vector<int>& heap, int index)
+{
+    const int node = heap[index];
+    while (index > 0)
+    {
+        const int parent = (index - 1) / 2;
+        if (!precedes(node, heap[parent]))
+        {
+            break;
+        }
+        heap[index] = heap[parent];
+        heap_position[heap[index]] = index;
+        index = parent;
+    }
+    heap[index] = node;
+    heap_position[node] = index;
+}
+
+void BCPSolver::DSatur::sift_down(std::vector<int>& heap, int index)
+{
+    const int size = static_cast<int>(heap.size());
+    const int node = heap[index];
+    while (true)
+    {
+        int child = 2 * index + 1;
+        if (child >= size)
+        {
+            break;
+        }
+        if (child + 1 < size && precedes(heap[child + 1], heap[child]))
+        {
+            child++;
+        }
+        if (!precedes(heap[child], node))
+        {
+            break;
+        }
+        heap[index] = heap[child];
+        heap_position[heap[index]] = index;
+        index = child;
+    }
+    heap[index] = node;
+    heap_position[node] = index;
+}
+
+void BCPSolver::DSatur::push(const int bucket, const int node)
+{
+    auto& heap = buckets[bucket];
+    heap.push_back(node);
+    sift_up(heap, static_cast<int>(heap.size()) - 1);
+    top_bucket = std::max(top_bucket, bucket);
+}
+
+void BCPSolver::DSatur::remove(const int bucket, const int node)
+{
+    auto& heap = buckets[bucket];
+    const int index = heap_position[node];
+    const int last = heap.back();
+    heap.pop_back();
+
+    if (last == node)
+    {
+        return;
+    }
+
+    heap[index] = last;
+    heap_position[last] = index;
+    sift_up(heap, index);
+    sift_down(heap, heap_position[last]);
+}
+
+int BCPSolver::DSatur::pop_best()
+{
+    while (buckets[top_bucket].empty())
+    {
+        top_bucket--;
+    }
+
+    const int node = buckets[top_bucket].front();
+    remove(top_bucket, node);
+    return node;
+}
+
+std::vector<int> BCPSolver::DSatur::run()
+{
+    const int n = graph->get_number_of_nodes();
+    std::vector colors(n, 0);
+    if (n == 0)
+    {
+        return colors;
+    }
+
+    const auto& priority = order.empty() ? graph->get_degree_order() : order;
+    rank.assign(n, 0);
+    for (int i = 0; i < n; i++)
+    {
+        rank[priority[i]] = i;
+    }
+
+    int max_degree = 0;
+    for (int i = 0; i < n; i++)
+    {
+        max_degree = std::max(max_degree, graph->get_degree(i));
+    }
+
+    saturation.assign(n, 0);
+    heap_position.assign(n, 0);
+    buckets.assign(max_degree + 1, {});
+    buckets[0].reserve(n);
+    top_bucket = 0;
+
+    for (const int node : priority)
+    {
+        push(0, node);
+    }
+
+    for (int colored = 0; colored < n; colored++)
+    {
+        const int node = pop_best();
+        colors[node] = first_fit_color(*graph, colors, node, intervals);
+
+        for (const int neighbor : graph->get_neighbors(node))
+        {
+            if (colors[neighbor] == 0)
+            {
+                remove(saturation[neighbor], neighbor);
+                saturation[neighbor]++;
+                push(saturation[neighbor], neighbor);
+            }
+        }
+    }
+
+    return colors;
+}
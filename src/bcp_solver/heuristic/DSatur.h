@@ -0,0 +1,55 @@
+#ifndef BCP_DSATUR_H
+#define BCP_DSATUR_H
+
+#include <utility>
+#include <vector>
+
+#include "bcp_solver/utility.h"
+
+namespace BCPSolver
+{
+    // DSatur for bandwidth coloring. The next vertex is the uncolored one with the most colored neighbors, ties
+    // broken by higher degree and then lower id; it gets the smallest color compatible with its colored neighbors.
+    //
+    // Uncolored vertices sit in buckets indexed by saturation. Each bucket is an indexed binary heap ordered by
+    // position in the degree order, so a saturation increase moves a vertex between buckets in O(log n) without
+    // leaving stale entries behind.
+    //
+    // A custom priority order replaces the degree order for breaking saturation ties, which is how the multi-start
+    // upper bound randomizes the engine.
+    class DSatur
+    {
+    private:
+        const Graph* graph;
+        std::vector<int> order;
+
+        std::vector<int> rank;
+        std::vector<int> saturation;
+        std::vector<std::vector<int>> buckets;
+        std::vector<int> heap_position;
+        std::vector<std::pair<int, int>> intervals;
+        int top_bucket{};
+
+        [[nodiscard]] bool precedes(int a, int b) const { return rank[a] < rank[b]; }
+
+        void sift_up(std::vector<int>& heap, int index);
+
+        void sift_down(std::vector<int>& heap, int index);
+
+        void push(int bucket, int node);
+
+        void remove(int bucket, int node);
+
+        int pop_best();
+
+    public:
+        explicit DSatur(const Graph* graph);
+
+        DSatur(const Graph* graph, std::vector<int> order);
+
+        // Returns a coloring with colors starting at 1; its span is the largest color used.
+        [[nodiscard]] std::vector<int> run();
+    };
+} // namespace BCPSolver
+
+#endif //BCP_DSATUR_H
@@ -0,0 +1,118 @@
+#include "MultiStart.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+#include "Coloring.h"
+#include "DSatur.h"
+#include "sat_solver/Deadline.h"
+
+BCPSolver::MultiStartUpperBound::MultiStartUpperBound(const Graph* graph, const int threads, const double time_limit)
+    : graph(graph), threads(std::max(threads, 1)), time_limit(time_limit)
+{
+}
+
+std::vector<int> BCPSolver::MultiStartUpperBound::random_order(const std::vector<int>& keys, std::mt19937& rng) const
+{
+    std::vector<int> order(graph->get_number_of_nodes());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+    std::stable_sort(order.begin(), order.end(), [&](const int a, const int b) { return keys[a] > keys[b]; });
+    return order;
+}
+
+std::vector<int> BCPSolver::MultiStartUpperBound::run_start(const int start)
+{
+    const int n = graph->get_number_of_nodes();
+    std::mt19937 rng(start);
+    std::vector<int> keys(n);
+
+    switch (start % NUMBER_OF_UPPER_BOUND_VARIANTS)
+    {
+    case DSATUR_DEGREE:
+        return DSatur(graph).run();
+    case DSATUR_RANDOM_TIES:
+        for (int i = 0; i < n; i++)
+        {
+            keys[i] = graph->get_degree(i);
+        }
+        return DSatur(graph, random_order(keys, rng)).run();
+    case DSATUR_WEIGHTED_DEGREE:
+        for (int i = 0; i < n; i++)
+        {
+            keys[i] = graph->get_weighted_degree(i);
+        }
+        return DSatur(graph, random_order(keys, rng)).run();
+    default:
+        {
+            std::lock_guard lock(best_mutex);
+            keys = best_coloring;
+        }
+        return greedy_coloring(*graph, random_order(keys, rng));
+    }
+}
+
+void BCPSolver::MultiStartUpperBound::offer(const int start, std::vector<int> coloring)
+{
+    const int span = get_coloring_span(coloring);
+
+    std::lock_guard lock(best_mutex);
+    if (best_start < 0 || span < best_span || (span == best_span && start < best_start))
+    {
+        best_coloring = std::move(coloring);
+        best_span = span;
+        best_start = start;
+    }
+}
+
+void BCPSolver::MultiStartUpperBound::work()
+{
+    while (true)
+    {
+        const int start = next_start.fetch_add(1);
+        const double elapsed = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - start_time).count();
+        // Past the deadline only the first start, run before the workers, is kept
+        if ((start >= threads && elapsed >= time_limit) || SATSolver::Deadline::global().expired())
+        {
+            return;
+        }
+
+        offer(start, run_start(start));
+    }
+}
+
+std::vector<int> BCPSolver::MultiStartUpperBound::run()
+{
+    start_time = std::chrono::high_resolution_clock::now();
+    best_start = -1;
+
+    offer(0, run_start(0));
+    next_start = 1;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (int i = 1; i < threads; i++)
+    {
+        workers.emplace_back(&MultiStartUpperBound::work, this);
+    }
+    work();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    return best_coloring;
+}
+
+BCPSolver::UpperBoundVariant BCPSolver::MultiStartUpperBound::get_winning_variant() const
+{
+    return static_cast<UpperBoundVariant>(best_start % NUMBER_OF_UPPER_BOUND_VARIANTS);
+}
+
+int BCPSolver::MultiStartUpperBound::get_number_of_starts() const
+{
+    // Every worker claims one start past the last it runs
+    return next_start.load() - threads;
+}
@@ -0,0 +1,67 @@
+#ifndef BCP_MULTISTART_H
+#define BCP_MULTISTART_H
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "bcp_solver/utility.h"
+
+namespace BCPSolver
+{
+    enum UpperBoundVariant
+    {
+        // DSatur with ties broken by degree, then id
+        DSATUR_DEGREE,
+        // DSatur with ties broken by degree, then at random
+        DSATUR_RANDOM_TIES,
+        // DSatur with ties broken by weighted degree, then at random
+        DSATUR_WEIGHTED_DEGREE,
+        // First fit over the best coloring found so far, taking its color classes from the highest color down
+        GREEDY_REVERSED_COLORS,
+        NUMBER_OF_UPPER_BOUND_VARIANTS
+    };
+
+    // Upper bound from many randomized heuristic starts. Start k runs variant k % NUMBER_OF_UPPER_BOUND_VARIANTS
+    // seeded with k. Start 0 is the plain DSatur and runs first, so the result is never worse than a single DSatur run
+    // and the reversed greedy always has a coloring to work from. The remaining starts are claimed by the worker
+    // threads from a shared counter until each thread has run one and the time budget is spent; a start that is
+    // running when the budget expires is finished.
+    class MultiStartUpperBound
+    {
+    private:
+        const Graph* graph;
+        int threads;
+        double time_limit;
+
+        std::chrono::high_resolution_clock::time_point start_time;
+        std::atomic<int> next_start{};
+
+        std::mutex best_mutex;
+        std::vector<int> best_coloring;
+        int best_span{};
+        int best_start{-1};
+
+        [[nodiscard]] std::vector<int> run_start(int start);
+
+        [[nodiscard]] std::vector<int> random_order(const std::vector<int>& keys, std::mt19937& rng) const;
+
+        void offer(int start, std::vector<int> coloring);
+
+        void work();
+
+    public:
+        MultiStartUpperBound(const Graph* graph, int threads, double time_limit);
+
+        // Returns the coloring with the smallest span; ties go to the earliest start.
+        [[nodiscard]] std::vector<int> run();
+
+        [[nodiscard]] UpperBoundVariant get_winning_variant() const;
+
+        [[nodiscard]] int get_number_of_starts() const;
+    };
+} // namespace BCPSolver
+
+#endif //BCP_MULTISTART_H
@@ -0,0 +1,208 @@
+#include "TabuSearch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "Coloring.h"
+#include "sat_solver/Deadline.h"
+
+BCPSolver::TabuSearch::TabuSearch(const Graph* graph, const double time_limit, const unsigned seed)
+    : graph(graph), time_limit(time_limit), rng(seed)
+{
+}
+
+void BCPSolver::TabuSearch::add_conflicts(const int node, const int color, const int delta)
+{
+    const auto neighbors = graph->get_neighbors(node);
+    const auto weights = graph->get_neighbor_weights(node);
+    for (std::size_t i = 0; i < neighbors.size(); i++)
+    {
+        // Colors strictly closer than the weight to `color` conflict at the neighbor
+        const int low = std::max(1, color - weights[i] + 1);
+        const int high = std::min(k, color + weights[i] - 1);
+        int* row = conflicts.data() + static_cast<std::size_t>(neighbors[i]) * k;
+        for (int c = low - 1; c < high; c++)
+        {
+            row[c] += delta;
+        }
+    }
+}
+
+void BCPSolver::TabuSearch::update_membership(const int node)
+{
+    const bool in_conflict = conflicts[static_cast<std::size_t>(node) * k + colors[node] - 1] > 0;
+    if (in_conflict == (conflicting_position[node] >= 0))
+    {
+        return;
+    }
+
+    if (in_conflict)
+    {
+        conflicting_position[node] = static_cast<int>(conflicting.size());
+        conflicting.push_back(node);
+    }
+    else
+    {
+        const int last = conflicting.back();
+        conflicting[conflicting_position[node]] = last;
+        conflicting_position[last] = conflicting_position[node];
+        conflicting.pop_back();
+        conflicting_position[node] = -1;
+    }
+}
+
+void BCPSolver::TabuSearch::recolor(const int node, const int color)
+{
+    const int* row = conflicts.data() + static_cast<std::size_t>(node) * k;
+    total_conflicts += row[color - 1] - row[colors[node] - 1];
+
+    add_conflicts(node, colors[node], -1);
+    add_conflicts(node, color, 1);
+    colors[node] = color;
+
+    update_membership(node);
+    for (const int neighbor : graph->get_neighbors(node))
+    {
+        update_membership(neighbor);
+    }
+}
+
+void BCPSolver::TabuSearch::shrink_to(const int span)
+{
+    const int n = graph->get_number_of_nodes();
+    k = span;
+    conflicts.assign(static_cast<std::size_t>(n) * k, 0);
+    tabu_until.assign(static_cast<std::size_t>(n) * k, 0);
+
+    std::vector<int> dropped;
+    for (int i = 0; i < n; i++)
+    {
+        if (colors[i] > k)
+        {
+            dropped.push_back(i);
+        }
+        else
+        {
+            add_conflicts(i, colors[i], 1);
+        }
+    }
+
+    std::shuffle(dropped.begin(), dropped.end(), rng);
+    for (const int node : dropped)
+    {
+        const int* row = conflicts.data() + static_cast<std::size_t>(node) * k;
+        colors[node] = static_cast<int>(std::min_element(row, row + k) - row) + 1;
+        add_conflicts(node, colors[node], 1);
+    }
+
+    total_conflicts = 0;
+    conflicting.clear();
+    conflicting_position.assign(n, -1);
+    for (int i = 0; i < n; i++)
+    {
+        total_conflicts += conflicts[static_cast<std::size_t>(i) * k + colors[i] - 1];
+        update_membership(i);
+    }
+    // Every violated edge was counted from both ends
+    total_conflicts /= 2;
+}
+
+void BCPSolver::TabuSearch::step(const int best_total)
+{
+    int best_delta = std::numeric_limits<int>::max();
+    int best_node = -1;
+    int best_color = 0;
+    int ties = 0;
+
+    for (const int node : conflicting)
+    {
+        const int* row = conflicts.data() + static_cast<std::size_t>(node) * k;
+        const long long* tabu = tabu_until.data() + static_cast<std::size_t>(node) * k;
+        const int current = row[colors[node] - 1];
+
+        for (int c = 1; c <= k; c++)
+        {
+            const int delta = row[c - 1] - current;
+            if (c == colors[node] || delta > best_delta)
+            {
+                continue;
+            }
+            // A tabu move is only taken when it beats the best conflict count seen at this span
+            if (tabu[c - 1] > iterations && total_conflicts + delta >= best_total)
+            {
+                continue;
+            }
+
+            if (delta < best_delta)
+            {
+                best_delta = delta;
+                ties = 0;
+            }
+            if (std::uniform_int_distribution(0, ties++)(rng) == 0)
+            {
+                best_node = node;
+                best_color = c;
+            }
+        }
+    }
+
+    if (best_node < 0)
+    {
+        best_node = conflicting[std::uniform_int_distribution<std::size_t>(0, conflicting.size() - 1)(rng)];
+        best_color = std::uniform_int_distribution(1, k)(rng);
+        if (best_color == colors[best_node])
+        {
+            best_color = best_color % k + 1;
+        }
+    }
+
+    const int tenure = std::uniform_int_distribution(0, 9)(rng) + static_cast<int>(0.6 * conflicting.size());
+    tabu_until[static_cast<std::size_t>(best_node) * k + colors[best_node] - 1] = iterations + tenure;
+    recolor(best_node, best_color);
+}
+
+std::vector<int> BCPSolver::TabuSearch::run(const std::vector<int>& initial)
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const auto out_of_time = [&]
+    {
+        return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count() >=
+            time_limit || SATSolver::Deadline::global().expired();
+    };
+
+    std::vector<int> best = initial;
+    colors = initial;
+
+    // No coloring can go below the heaviest edge + 1
+    const int lowest_span = graph->get_max_weight() + 1;
+    int span = get_coloring_span(initial);
+
+    while (span - 1 >= lowest_span && span - 1 >= 1 && !out_of_time())
+    {
+        shrink_to(span - 1);
+
+        int best_total = total_conflicts;
+        while (total_conflicts > 0)
+        {
+            if ((iterations & 63) == 0 && out_of_time())
+            {
+                return best;
+            }
+
+            step(best_total);
+            iterations++;
+            best_total = std::min(best_total, total_conflicts);
+        }
+
+        best = colors;
+        span = get_coloring_span(colors);
+    }
+
+    return best;
+}
+
+long long BCPSolver::TabuSearch::get_iterations() const
+{
+    return iterations;
+}
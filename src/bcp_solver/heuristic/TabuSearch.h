@@ -0,0 +1,56 @@
+#ifndef BCP_TABUSEARCH_H
+#define BCP_TABUSEARCH_H
+
+#include <random>
+#include <vector>
+
+#include "bcp_solver/utility.h"
+
+namespace BCPSolver
+{
+    // Tabucol-style local search that lowers the span of a valid coloring. At span k every vertex holds a color in
+    // 1..k and the search minimizes the number of violated edges by recoloring conflicting vertices; once no edge is
+    // violated the coloring is kept and k is decreased, the vertices on the dropped color being moved to their least
+    // conflicting color.
+    //
+    // conflicts[v * k + c - 1] counts the neighbors that color c would conflict with at v. A move of u from a to b
+    // only touches the rows of u's neighbors, over the windows of width 2w - 1 around a and b, so both the update and
+    // the scan for the best color of a vertex are contiguous loops.
+    class TabuSearch
+    {
+    private:
+        const Graph* graph;
+        double time_limit;
+        std::mt19937 rng;
+
+        int k{};
+        std::vector<int> colors;
+        std::vector<int> conflicts;
+        std::vector<long long> tabu_until;
+        std::vector<int> conflicting;
+        std::vector<int> conflicting_position;
+        int total_conflicts{};
+        long long iterations{};
+
+        void add_conflicts(int node, int color, int delta);
+
+        void update_membership(int node);
+
+        void recolor(int node, int color);
+
+        // Rebuilds the tables for span k; vertices whose color is above k take their least conflicting color.
+        void shrink_to(int span);
+
+        void step(int best_total);
+
+    public:
+        TabuSearch(const Graph* graph, double time_limit, unsigned seed = 0);
+
+        // Returns the valid coloring with the smallest span found within the time limit, or the initial coloring.
+        [[nodiscard]] std::vector<int> run(const std::vector<int>& initial);
+
+        [[nodiscard]] long long get_iterations() const;
+    };
+} // namespace BCPSolver
+
+#endif //BCP_TABUSEARCH_H
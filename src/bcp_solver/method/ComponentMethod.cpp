@@ -0,0 +1,319 @@
+#include "ComponentMethod.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "bcp_solver/heuristic/Coloring.h"
+
+BCPSolver::ComponentMethod::ComponentMethod(const SolvingMethod method, const Graph* graph,
+                                            const SATSolver::SOLVER solver,
+                                            const std::vector<std::vector<int>>& vertex_sets, const int upper_bound,
+                                            const bool use_symmetry_breaking, const bool use_heuristic,
+                                            const std::string& width, const SolverOptions& options)
+    : BCPSolver(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options)
+{
+    std::vector component_of(graph->get_number_of_nodes(), 0);
+    std::vector local_id(graph->get_number_of_nodes(), 0);
+    for (std::size_t k = 0; k < vertex_sets.size(); k++)
+    {
+        Component component;
+        component.vertices = vertex_sets[k];
+        for (std::size_t i = 0; i < component.vertices.size(); i++)
+        {
+            component_of[component.vertices[i]] = static_cast<int>(k);
+            local_id[component.vertices[i]] = static_cast<int>(i);
+        }
+        if (component.vertices.size() > 1)
+        {
+            component.subgraph = std::make_unique<Graph>(static_cast<int>(component.vertices.size()));
+        }
+        components.push_back(std::move(component));
+    }
+
+    for (const auto& [u, v, weight] : graph->get_edges())
+    {
+        components[component_of[u]].subgraph->add_edge(local_id[u], local_id[v], weight);
+    }
+
+    // Only a given upper bound applies to every component; otherwise each one computes its own
+    auto member_options = options;
+    member_options.component_threads = 0;
+    for (auto& component : components)
+    {
+        if (component.subgraph != nullptr)
+        {
+            component.subgraph->build_adjacency();
+            component.worker.reset(create_solver(method, component.subgraph.get(), solver, upper_bound,
+                                                 use_symmetry_breaking, use_heuristic, width, member_options));
+        }
+    }
+}
+
+std::vector<std::vector<int>> BCPSolver::ComponentMethod::find_components(const Graph* graph)
+{
+    std::vector<std::vector<int>> vertex_sets;
+    std::vector visited(graph->get_number_of_nodes(), false);
+    for (int start = 0; start < graph->get_number_of_nodes(); start++)
+    {
+        if (visited[start])
+        {
+            continue;
+        }
+
+        std::vector<int> vertices{start};
+        visited[start] = true;
+        for (std::size_t next = 0; next < vertices.size(); next++)
+        {
+            for (const int v : graph->get_neighbors(vertices[next]))
+            {
+                if (!visited[v])
+                {
+                    visited[v] = true;
+                    vertices.push_back(v);
+                }
+            }
+        }
+        std::ranges::sort(vertices);
+        vertex_sets.push_back(std::move(vertices));
+    }
+
+    std::ranges::stable_sort(vertex_sets, [](const auto& a, const auto& b) { return a.size() > b.size(); });
+    return vertex_sets;
+}
+
+void BCPSolver::ComponentMethod::encode()
+{
+    throw std::logic_error("The components are encoded by their own solvers");
+}
+
+void BCPSolver::ComponentMethod::create_variable()
+{
+    throw std::logic_error("The components are encoded by their own solvers");
+}
+
+void BCPSolver::ComponentMethod::encode_edge(int, int, int)
+{
+    throw std::logic_error("The components are encoded by their own solvers");
+}
+
+std::vector<int>* BCPSolver::ComponentMethod::create_assumptions(const std::string&, int)
+{
+    throw std::logic_error("The components are encoded by their own solvers");
+}
+
+BCPSolver::SolverStatus BCPSolver::ComponentMethod::solve_until_deadline(const double time_limit,
+                                                                         const bool find_optimal,
+                                                                         const bool incremental,
+                                                                         const std::string& variable_for_incremental)
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Span every component may use: a lower bound of the whole graph, raised by components proven to need more
+    std::atomic target{lower_bound};
+    std::vector<std::unique_ptr<SharedBounds>> bounds;
+    std::vector<std::size_t> pending;
+    for (std::size_t k = 0; k < components.size(); k++)
+    {
+        const auto* worker = components[k].worker.get();
+        if (worker == nullptr)
+        {
+            bounds.emplace_back();
+            continue;
+        }
+        bounds.push_back(std::make_unique<SharedBounds>(
+            worker->heuristic_coloring.empty() ? worker->upper_bound + 1 : worker->upper_bound,
+            std::max(worker->lower_bound, lower_bound)));
+        pending.push_back(k);
+    }
+
+    const auto raise_target = [&](const int span)
+    {
+        int current = target.load(std::memory_order_acquire);
+        while (span > current && !target.compare_exchange_weak(current, span, std::memory_order_acq_rel))
+        {
+        }
+        // Spans below the target no longer matter for any component, as if they were infeasible
+        for (const auto& component_bounds : bounds)
+        {
+            if (component_bounds != nullptr)
+            {
+                component_bounds->offer_lower_bound(target.load(std::memory_order_acquire));
+            }
+        }
+    };
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::exception_ptr> errors(pending.size());
+    const auto run = [&]
+    {
+        for (std::size_t p = next++; p < pending.size() && !failed.load(std::memory_order_relaxed); p = next++)
+        {
+            auto& component = components[pending[p]];
+            BCPSolver* worker = component.worker.get();
+            SharedBounds* worker_bounds = bounds[pending[p]].get();
+            try
+            {
+                if (find_optimal && !worker->heuristic_coloring.empty() &&
+                    get_coloring_span(worker->heuristic_coloring) <= target.load(std::memory_order_acquire))
+                {
+                    worker->coloring = worker->heuristic_coloring;
+                    worker->span = get_coloring_span(worker->coloring);
+                    worker->status = SATISFIABLE;
+                    component.skipped = true;
+                    continue;
+                }
+
+                if (find_optimal)
+                {
+                    worker->shared_bounds = worker_bounds;
+                    worker->sat_solver->set_interrupt([worker, worker_bounds]
+                    {
+                        return worker->probing && worker_bounds->settles(worker->span);
+                    });
+                }
+                if (worker->solve_until_deadline(time_limit, find_optimal, incremental, variable_for_incremental) ==
+                    OPTIMAL)
+                {
+                    raise_target(worker->span);
+                }
+            }
+            catch (...)
+            {
+                errors[p] = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // The components are taken largest first, so the one most likely to set the span usually runs before the
+    // small ones that then only have to match it
+    const int thread_count = std::clamp(options.component_threads, 1, std::max(1, static_cast<int>(pending.size())));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back(run);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto& component : components)
+    {
+        if (component.worker != nullptr)
+        {
+            component.worker->shared_bounds = nullptr;
+            component.worker->sat_solver->set_interrupt({});
+        }
+    }
+    component_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Components left without a coloring fall back on the heuristic coloring of the whole graph
+    coloring.assign(graph->get_number_of_nodes(), 1);
+    bool complete = true;
+    bool settled = true;
+    bool any_unsatisfiable = false;
+    int member_span = 1;
+    for (const auto& component : components)
+    {
+        if (component.worker == nullptr)
+        {
+            continue;
+        }
+
+        const auto colors = component.worker->get_coloring();
+        any_unsatisfiable |= component.worker->status == UNSATISFIABLE;
+        settled &= component.skipped || component.worker->status == OPTIMAL;
+        member_span = std::max(member_span, component.worker->get_span());
+        for (std::size_t i = 0; i < component.vertices.size(); i++)
+        {
+            const int node = component.vertices[i];
+            if (!colors.empty())
+            {
+                coloring[node] = colors[i];
+            }
+            else if (!heuristic_coloring.empty())
+            {
+                coloring[node] = heuristic_coloring[node];
+            }
+        }
+        complete &= !colors.empty() || !heuristic_coloring.empty();
+    }
+
+    if (!find_optimal)
+    {
+        if (any_unsatisfiable)
+        {
+            status = UNSATISFIABLE;
+            coloring.clear();
+        }
+        else if (std::ranges::all_of(components, [](const auto& component)
+        {
+            return component.worker == nullptr || component.worker->status == SATISFIABLE;
+        }))
+        {
+            span = member_span;
+            status = SATISFIABLE;
+        }
+        else
+        {
+            status = UNKNOWN;
+            coloring.clear();
+        }
+        return status;
+    }
+
+    if (!complete)
+    {
+        status = UNKNOWN;
+        coloring.clear();
+        return status;
+    }
+    span = get_coloring_span(coloring);
+    status = settled || span <= target.load() ? OPTIMAL : SATISFIABLE;
+    return status;
+}
+
+std::unordered_map<std::string, double> BCPSolver::ComponentMethod::get_statistics() const
+{
+    auto stats = BCPSolver::get_statistics();
+    stats["components"] = static_cast<double>(components.size());
+    stats["isolated_vertices"] = static_cast<double>(std::ranges::count_if(components, [](const auto& component)
+    {
+        return component.worker == nullptr;
+    }));
+    stats["components_skipped"] = static_cast<double>(std::ranges::count_if(components, [](const auto& component)
+    {
+        return component.skipped;
+    }));
+
+    constexpr const char* SUMMED[] = {"clauses", "variables", "solves", "learned", "encoding_time", "total_solving_time"};
+    for (const auto* key : SUMMED)
+    {
+        stats[key] = 0;
+    }
+    for (const auto& component : components)
+    {
+        if (component.worker != nullptr)
+        {
+            const auto worker_stats = component.worker->get_statistics();
+            for (const auto* key : SUMMED)
+            {
+                stats[key] += worker_stats.at(key);
+            }
+        }
+    }
+    // The components run side by side, so the time is the wall-clock time of the whole stage
+    stats["time_used"] = component_time;
+
+    return stats;
+}
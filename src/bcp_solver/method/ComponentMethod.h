@@ -0,0 +1,55 @@
+#ifndef BCP_COMPONENTMETHOD_H
+#define BCP_COMPONENTMETHOD_H
+#include "bcp_solver/bcp_solver.h"
+
+namespace BCPSolver
+{
+    // Solves every connected component of the graph on its own solver of the chosen method, on a pool of threads.
+    // The span of the graph is the largest span of its components, so a component only has to reach the largest
+    // lower bound known for any of them: components whose heuristic coloring already does so make no SAT call, and
+    // running ones stop once another component raises that bound above their span. Isolated vertices take color 1
+    // and are never encoded.
+    class ComponentMethod : public BCPSolver
+    {
+    private:
+        struct Component
+        {
+            // Vertices of the graph, in the order of the subgraph's vertices
+            std::vector<int> vertices;
+            // Null for an isolated vertex
+            std::unique_ptr<Graph> subgraph;
+            std::unique_ptr<BCPSolver> worker;
+            // Settled by the worker's heuristic coloring without any SAT call
+            bool skipped{false};
+        };
+
+        std::vector<Component> components;
+        double component_time{};
+
+        void encode() override;
+
+        void create_variable() override;
+
+        void encode_edge(int u, int v, int weight) override;
+
+        std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) override;
+
+        SolverStatus solve_until_deadline(double time_limit, bool find_optimal, bool incremental,
+                                          const std::string& variable_for_incremental) override;
+
+        friend class BCPSolver;
+
+        explicit ComponentMethod(SolvingMethod method, const Graph* graph, SATSolver::SOLVER solver,
+                                 const std::vector<std::vector<int>>& vertex_sets, int upper_bound,
+                                 bool use_symmetry_breaking, bool use_heuristic, const std::string& width,
+                                 const SolverOptions& options);
+
+    public:
+        // Vertex sets of the connected components, largest first
+        static std::vector<std::vector<int>> find_components(const Graph* graph);
+
+        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const override;
+    };
+}
+
+#endif //BCP_COMPONENTMETHOD_H
@@ -0,0 +1,268 @@
+#include "KernelMethod.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "bcp_solver/heuristic/Coloring.h"
+
+namespace
+{
+    // Statistics added up over the workers of all kernels
+    constexpr const char* SUMMED_STATISTICS[] = {
+        "clauses", "variables", "solves", "learned", "encoding_time", "total_solving_time", "time_used"
+    };
+}
+
+BCPSolver::KernelMethod::KernelMethod(const SolvingMethod method, const Graph* graph, const SATSolver::SOLVER solver,
+                                      const int upper_bound, const bool use_symmetry_breaking,
+                                      const bool use_heuristic, const std::string& width,
+                                      const SolverOptions& options)
+    : BCPSolver(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options), method(method),
+      solver(solver), width(width)
+{
+    create_worker(this->upper_bound, heuristic_coloring);
+}
+
+BCPSolver::KernelMethod::Kernel BCPSolver::KernelMethod::reduce(const Graph* graph, const int span)
+{
+    const int n = graph->get_number_of_nodes();
+    std::vector load(n, 0);
+    for (int v = 0; v < n; v++)
+    {
+        for (const int weight : graph->get_neighbor_weights(v))
+        {
+            load[v] += 2 * weight - 1;
+        }
+    }
+
+    // A vertex is removed once its load drops below the span and only lowers the load of the vertices still kept,
+    // so its load at removal counts exactly the neighbors colored before it on reinsertion
+    Kernel kernel;
+    std::vector removed(n, false);
+    for (int v = 0; v < n; v++)
+    {
+        if (load[v] < span)
+        {
+            removed[v] = true;
+            kernel.removed.push_back(v);
+        }
+    }
+    for (std::size_t next = 0; next < kernel.removed.size(); next++)
+    {
+        const int v = kernel.removed[next];
+        kernel.valid_from = std::max(kernel.valid_from, load[v] + 1);
+
+        const auto neighbors = graph->get_neighbors(v);
+        const auto weights = graph->get_neighbor_weights(v);
+        for (std::size_t k = 0; k < neighbors.size(); k++)
+        {
+            if (const int u = neighbors[k]; !removed[u])
+            {
+                load[u] -= 2 * weights[k] - 1;
+                if (load[u] < span)
+                {
+                    removed[u] = true;
+                    kernel.removed.push_back(u);
+                }
+            }
+        }
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        if (!removed[v])
+        {
+            kernel.vertices.push_back(v);
+        }
+    }
+    return kernel;
+}
+
+void BCPSolver::KernelMethod::create_worker(const int worker_span, const std::vector<int>& colors)
+{
+    kernel = reduce(graph, worker_span);
+    kernel_rounds++;
+    if (kernel.vertices.empty())
+    {
+        kernel_graph.reset();
+        return;
+    }
+
+    std::vector local_id(graph->get_number_of_nodes(), -1);
+    for (std::size_t i = 0; i < kernel.vertices.size(); i++)
+    {
+        local_id[kernel.vertices[i]] = static_cast<int>(i);
+    }
+    kernel_graph = std::make_unique<Graph>(static_cast<int>(kernel.vertices.size()));
+    for (const auto& [u, v, weight] : graph->get_edges())
+    {
+        if (local_id[u] >= 0 && local_id[v] >= 0)
+        {
+            kernel_graph->add_edge(local_id[u], local_id[v], weight);
+        }
+    }
+    kernel_graph->build_adjacency();
+
+    auto member_options = options;
+    member_options.kernelize = false;
+    worker.reset(create_solver(method, kernel_graph.get(), solver, worker_span, use_symmetry_breaking, use_heuristic,
+                               width, member_options));
+
+    // Below valid_from the kernel may be colorable while the graph is not, so the worker treats those spans as
+    // infeasible
+    worker->lower_bound = std::max({worker->lower_bound, lower_bound, kernel.valid_from});
+    if (!colors.empty())
+    {
+        worker->heuristic_coloring.resize(kernel.vertices.size());
+        for (std::size_t i = 0; i < kernel.vertices.size(); i++)
+        {
+            worker->heuristic_coloring[i] = colors[kernel.vertices[i]];
+        }
+    }
+}
+
+std::vector<int> BCPSolver::KernelMethod::reinsert(const std::vector<int>& kernel_colors) const
+{
+    std::vector colors(graph->get_number_of_nodes(), 0);
+    for (std::size_t i = 0; i < kernel.vertices.size(); i++)
+    {
+        colors[kernel.vertices[i]] = kernel_colors[i];
+    }
+
+    for (auto it = kernel.removed.rbegin(); it != kernel.removed.rend(); ++it)
+    {
+        const auto neighbors = graph->get_neighbors(*it);
+        const auto weights = graph->get_neighbor_weights(*it);
+
+        // Every conflicting neighbor pushes the candidate past its blocked range, so the first color left is free
+        int color = 1;
+        for (bool conflict = true; conflict;)
+        {
+            conflict = false;
+            for (std::size_t k = 0; k < neighbors.size(); k++)
+            {
+                if (const int other = colors[neighbors[k]]; other > 0 && std::abs(color - other) < weights[k])
+                {
+                    color = other + weights[k];
+                    conflict = true;
+                }
+            }
+        }
+        colors[*it] = color;
+    }
+    return colors;
+}
+
+void BCPSolver::KernelMethod::retire_worker()
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+    const auto worker_stats = worker->get_statistics();
+    for (const auto* key : SUMMED_STATISTICS)
+    {
+        finished_statistics[key] += worker_stats.contains(key) ? worker_stats.at(key) : 0;
+    }
+    worker.reset();
+}
+
+void BCPSolver::KernelMethod::encode()
+{
+    throw std::logic_error("The kernel is encoded by its own solver");
+}
+
+void BCPSolver::KernelMethod::create_variable()
+{
+    throw std::logic_error("The kernel is encoded by its own solver");
+}
+
+void BCPSolver::KernelMethod::encode_edge(int, int, int)
+{
+    throw std::logic_error("The kernel is encoded by its own solver");
+}
+
+std::vector<int>* BCPSolver::KernelMethod::create_assumptions(const std::string&, int)
+{
+    throw std::logic_error("The kernel is encoded by its own solver");
+}
+
+BCPSolver::SolverStatus BCPSolver::KernelMethod::solve_until_deadline(const double time_limit,
+                                                                      const bool find_optimal,
+                                                                      const bool incremental,
+                                                                      const std::string& variable_for_incremental)
+{
+    while (true)
+    {
+        // An empty kernel is colored without any color
+        SolverStatus result = OPTIMAL;
+        std::vector<int> kernel_colors;
+        int kernel_span = 0;
+        if (worker != nullptr)
+        {
+            result = worker->solve_until_deadline(time_limit, find_optimal, incremental, variable_for_incremental);
+            kernel_colors = worker->get_coloring();
+            kernel_span = worker->get_span();
+        }
+
+        if (result == UNSATISFIABLE)
+        {
+            // The kernel is colorable within its span exactly when the graph is
+            status = coloring.empty() ? UNSATISFIABLE : OPTIMAL;
+            return status;
+        }
+        if (result == UNKNOWN)
+        {
+            status = coloring.empty() ? UNKNOWN : SATISFIABLE;
+            return status;
+        }
+
+        if (auto compacted = compact_coloring(*graph, reinsert(kernel_colors));
+            coloring.empty() || get_coloring_span(compacted) < get_coloring_span(coloring))
+        {
+            coloring = std::move(compacted);
+        }
+        if (!find_optimal)
+        {
+            status = SATISFIABLE;
+            return status;
+        }
+
+        span = get_coloring_span(coloring);
+        if (result != OPTIMAL)
+        {
+            status = SATISFIABLE;
+            return status;
+        }
+        // Stopping above valid_from means the kernel itself needs the span; at valid_from the spans below are
+        // checked on the kernel that is valid for them
+        if (kernel_span > kernel.valid_from || span <= lower_bound)
+        {
+            status = OPTIMAL;
+            return status;
+        }
+        if (time_limit != NO_TIME_LIMIT && get_remaining_time(time_limit) <= 0)
+        {
+            status = SATISFIABLE;
+            return status;
+        }
+
+        retire_worker();
+        create_worker(span - 1, coloring);
+    }
+}
+
+std::unordered_map<std::string, double> BCPSolver::KernelMethod::get_statistics() const
+{
+    auto stats = BCPSolver::get_statistics();
+    const auto worker_stats = worker != nullptr ? worker->get_statistics() : std::unordered_map<std::string, double>{};
+    for (const auto* key : SUMMED_STATISTICS)
+    {
+        stats[key] = (finished_statistics.contains(key) ? finished_statistics.at(key) : 0) +
+            (worker_stats.contains(key) ? worker_stats.at(key) : 0);
+    }
+    stats["kernel_removed"] = static_cast<double>(kernel.removed.size());
+    stats["kernel_rounds"] = kernel_rounds;
+
+    return stats;
+}
@@ -0,0 +1,70 @@
+#ifndef BCP_KERNELMETHOD_H
+#define BCP_KERNELMETHOD_H
+#include "bcp_solver/bcp_solver.h"
+
+namespace BCPSolver
+{
+    // Solves the kernel of the graph with a solver of the chosen method. A vertex whose neighbors block fewer colors
+    // than the span, sum of 2w - 1 over its edges, can always be colored after them, so such vertices are removed
+    // one after the other and given the smallest free color, in reverse order, once the kernel is colored. The
+    // removal only holds from some span on; when the search reaches it, the kernel is computed again for the spans
+    // below and solved by a new solver.
+    class KernelMethod : public BCPSolver
+    {
+    public:
+        struct Kernel
+        {
+            // Vertices of the graph kept in the kernel, in the order of the kernel's vertices
+            std::vector<int> vertices;
+            // Removed vertices in the order they were removed
+            std::vector<int> removed;
+            // Smallest span the removal holds for
+            int valid_from{};
+        };
+
+    private:
+        SolvingMethod method;
+        SATSolver::SOLVER solver;
+        std::string width;
+
+        Kernel kernel;
+        std::unique_ptr<Graph> kernel_graph;
+        std::unique_ptr<BCPSolver> worker;
+        // Statistics of the workers of the earlier kernels
+        std::unordered_map<std::string, double> finished_statistics;
+        int kernel_rounds{};
+
+        // Reduces the graph for the span and starts a worker on the kernel, warm-started from the coloring
+        void create_worker(int worker_span, const std::vector<int>& colors);
+
+        // Colors the removed vertices in reverse order with the smallest color their colored neighbors leave free
+        [[nodiscard]] std::vector<int> reinsert(const std::vector<int>& kernel_colors) const;
+
+        void retire_worker();
+
+        void encode() override;
+
+        void create_variable() override;
+
+        void encode_edge(int u, int v, int weight) override;
+
+        std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) override;
+
+        SolverStatus solve_until_deadline(double time_limit, bool find_optimal, bool incremental,
+                                          const std::string& variable_for_incremental) override;
+
+        friend class BCPSolver;
+
+        explicit KernelMethod(SolvingMethod method, const Graph* graph, SATSolver::SOLVER solver, int upper_bound,
+                              bool use_symmetry_breaking, bool use_heuristic, const std::string& width,
+                              const SolverOptions& options);
+
+    public:
+        // Removes vertices that can be colored last within the span until none is left
+        static Kernel reduce(const Graph* graph, int span);
+
+        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const override;
+    };
+}
+
+#endif //BCP_KERNELMETHOD_H
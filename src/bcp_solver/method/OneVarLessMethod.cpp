@@ -6,14 +6,14 @@
 
 void BCPSolver::OneVarLessMethod::symmetry_breaking()
 {
-    sat_solver->add_clause(y[{graph->get_highest_degree_vertex(), span / 2 + 1}]);
+    sat_solver->add_clause(y(graph->get_highest_degree_vertex(), span / 2 + 1));
 }
 
 void BCPSolver::OneVarLessMethod::first_constraint()
 {
     for (int i = 0; i < graph->get_number_of_nodes(); i++)
     {
-        sat_solver->add_clause(y[{i, span}]);
+        sat_solver->add_clause(y(i, span));
     }
 }
 
@@ -23,50 +23,45 @@ void BCPSolver::OneVarLessMethod::second_constraint()
     {
         for (int c = 1; c < span; c++)
         {
-            sat_solver->add_clause(-y[{i, c}], y[{i, c + 1}]);
+            sat_solver->add_clause(-y(i, c), y(i, c + 1));
         }
     }
 }
 
-void BCPSolver::OneVarLessMethod::third_constraint()
+void BCPSolver::OneVarLessMethod::encode_edge(const int u, const int v, const int weight)
 {
-    for (const auto& edge : graph->get_edges())
+    for (int c = 1; c <= span; c++)
     {
-        auto [u, v, weight] = edge;
-
-        for (int c = 1; c <= span; c++)
+        if (c - weight < 1 && c + weight - 1 > span)
+        {
+            sat_solver->add_clause(-y(u, c), y(u, c - 1));
+        }
+        else if (c - weight < 1)
         {
-            if (c - weight < 1 && c + weight - 1 > span)
+            if (c == 1)
             {
-                sat_solver->add_clause(-y[{u, c}], y[{u, c - 1}]);
+                sat_solver->add_clause(-y(u, c), -y(v, c + weight - 1));
             }
-            else if (c - weight < 1)
+            else
             {
-                if (c == 1)
-                {
-                    sat_solver->add_clause(-y[{u, c}], -y[{v, c + weight - 1}]);
-                }
-                else
-                {
-                    sat_solver->add_clause(-y[{u, c}], y[{u, c - 1}], -y[{v, c + weight - 1}]);
-                }
+                sat_solver->add_clause(-y(u, c), y(u, c - 1), -y(v, c + weight - 1));
             }
-            else if (c + weight - 1 > span)
+        }
+        else if (c + weight - 1 > span)
+        {
+            if (c == 1)
             {
-                if (c == 1)
-                {
-                    sat_solver->add_clause(-y[{u, c}]);
-                }
-                else
-                {
-                    sat_solver->add_clause(-y[{u, c}], y[{u, c - 1}], y[{v, c - weight}]);
-                }
+                sat_solver->add_clause(-y(u, c));
             }
             else
             {
-                sat_solver->add_clause(-y[{u, c}], y[{u, c - 1}], -y[{v, c + weight - 1}], y[{v, c - weight}]);
+                sat_solver->add_clause(-y(u, c), y(u, c - 1), y(v, c - weight));
             }
         }
+        else
+        {
+            sat_solver->add_clause(-y(u, c), y(u, c - 1), -y(v, c + weight - 1), y(v, c - weight));
+        }
     }
 }
 
@@ -83,38 +78,79 @@ void BCPSolver::OneVarLessMethod::encode()
 
     first_constraint();
     second_constraint();
-    third_constraint();
+    encode_edges();
 
     encoding_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
 }
 
 void BCPSolver::OneVarLessMethod::create_variable()
 {
-    y.clear();
+    y.assign(sat_solver->create_new_variables(graph->get_number_of_nodes() * span), span);
+}
 
+std::vector<int>* BCPSolver::OneVarLessMethod::create_assumptions(
+    const std::string& variable_for_incremental, const int limit)
+{
+    if (variable_for_incremental != "y")
+    {
+        throw std::runtime_error("Invalid variable for incremental in OneVarLessMethod.");
+    }
+
+    auto* assumptions = new std::vector<int>();
+    if (limit >= encoded_span)
+    {
+        return assumptions;
+    }
+
+    // y(i, c) means color <= c
     for (int i = 0; i < graph->get_number_of_nodes(); i++)
     {
-        for (int c = 1; c < span + 1; c++)
+        assumptions->push_back(y(i, limit));
+    }
+    return assumptions;
+}
+
+std::vector<int> BCPSolver::OneVarLessMethod::decode_coloring(const SATSolver::SatSolver& model) const
+{
+    // y(i, c) means color <= c, so the color is the first true y
+    std::vector colors(graph->get_number_of_nodes(), y.get_number_of_colors());
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
+    {
+        for (int c = 1; c <= y.get_number_of_colors(); c++)
         {
-            y.insert(std::pair<std::pair<int, int>, int>({i, c}, sat_solver->create_new_variable()));
+            if (model.value(y(i, c)) > 0)
+            {
+                colors[i] = c;
+                break;
+            }
         }
     }
+    return colors;
 }
 
-std::vector<int>* BCPSolver::OneVarLessMethod::create_assumptions(const std::string& variable_for_incremental)
+std::vector<int> BCPSolver::OneVarLessMethod::color_range_literals(const int node, const int low, const int high) const
 {
-    if (variable_for_incremental=="y")
+    // y(i, c) means color <= c
+    std::vector<int> literals;
+    if (high < y.get_number_of_colors())
+    {
+        literals.push_back(y(node, high));
+    }
+    if (low > 1)
     {
-        auto* assumptions = new std::vector<int>(graph->get_number_of_nodes());
+        literals.push_back(-y(node, low - 1));
+    }
+    return literals;
+}
 
-        for (int i = 0; i < graph->get_number_of_nodes(); i++)
+void BCPSolver::OneVarLessMethod::set_coloring_phases(const std::vector<int>& colors)
+{
+    // y(i, c) means color <= c
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
+    {
+        for (int c = 1; c <= y.get_number_of_colors(); c++)
         {
-            (*assumptions)[i] = y[{i, span - 1}];
+            sat_solver->set_phase(c >= colors[i] ? y(i, c) : -y(i, c));
         }
-        return assumptions;
-    }
-    else
-    {
-        throw std::runtime_error("Invalid variable for incremental in OneVarLessMethod.");
     }
 }
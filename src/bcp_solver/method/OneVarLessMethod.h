@@ -18,21 +18,28 @@ namespace BCPSolver
 
         void second_constraint();
 
-        void third_constraint();
+        void encode_edge(int u, int v, int weight) override;
 
         void encode() override;
 
         void create_variable() override;
 
-        std::vector<int>* create_assumptions(const std::string& variable_for_incremental) override;
+        std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) override;
+
+        void set_coloring_phases(const std::vector<int>& colors) override;
+
+        [[nodiscard]] std::vector<int> decode_coloring(const SATSolver::SatSolver& model) const override;
+
+        [[nodiscard]] std::vector<int> color_range_literals(int node, int low, int high) const override;
 
         friend class BCPSolver;
 
         explicit OneVarLessMethod(const Graph* graph, const SATSolver::SOLVER solver,
                                   const int upper_bound,
                                   const bool use_symmetry_breaking,
-                                  const bool use_heuristic) : BCPSolver(
-            graph, solver, upper_bound, use_symmetry_breaking, use_heuristic)
+                                  const bool use_heuristic,
+                                  const SolverOptions& options) : BCPSolver(
+            graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options)
         {
             if (use_heuristic)
             {
@@ -0,0 +1,186 @@
+#include "PortfolioMethod.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "bcp_solver/heuristic/Coloring.h"
+#include "cadical.hpp"
+
+BCPSolver::PortfolioMethod::PortfolioMethod(const Graph* graph, const int upper_bound,
+                                            const bool use_symmetry_breaking, const bool use_heuristic,
+                                            const SolverOptions& options)
+    : BCPSolver(graph, SATSolver::CADICAL, upper_bound, use_symmetry_breaking, use_heuristic, options)
+{
+    const int threads = std::clamp(options.portfolio_threads, 1, MAX_THREADS);
+    // The encodings already run side by side, so each one probes a single span at a time
+    auto member_options = options;
+    member_options.probe_threads = 0;
+    for (int k = 0; k < threads; k++)
+    {
+        const auto& member = MEMBERS[k];
+        workers.emplace_back(create_solver(member.method, graph, SATSolver::CADICAL, this->upper_bound,
+                                           use_symmetry_breaking, use_heuristic && member.supports_pairwise,
+                                           member.width, member_options));
+        // Every worker starts from the coloring the portfolio found for its upper bound
+        workers.back()->heuristic_coloring = heuristic_coloring;
+    }
+}
+
+void BCPSolver::PortfolioMethod::encode()
+{
+    throw std::logic_error("The portfolio has no encoding of its own");
+}
+
+void BCPSolver::PortfolioMethod::create_variable()
+{
+    throw std::logic_error("The portfolio has no encoding of its own");
+}
+
+void BCPSolver::PortfolioMethod::encode_edge(int, int, int)
+{
+    throw std::logic_error("The portfolio has no encoding of its own");
+}
+
+std::vector<int>* BCPSolver::PortfolioMethod::create_assumptions(const std::string&, int)
+{
+    throw std::logic_error("The portfolio has no encoding of its own");
+}
+
+BCPSolver::SolverStatus BCPSolver::PortfolioMethod::solve_until_deadline(const double time_limit,
+                                                                         const bool find_optimal,
+                                                                         const bool incremental,
+                                                                         const std::string&)
+{
+    // Without a heuristic coloring nothing is known to be feasible yet
+    SharedBounds bounds(heuristic_coloring.empty() ? upper_bound + 1 : upper_bound, lower_bound);
+    std::atomic<bool> answered{false};
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(workers.size());
+    for (std::size_t k = 0; k < workers.size(); k++)
+    {
+        BCPSolver* worker = workers[k].get();
+        worker->shared_bounds = &bounds;
+
+        // A worker stops its probe once another one has answered it or has finished the whole search
+        worker->sat_solver->set_interrupt([worker, &bounds, &answered]
+        {
+            return answered.load(std::memory_order_relaxed) || bounds.is_optimal() ||
+                (worker->probing && bounds.settles(worker->span));
+        });
+
+        threads.emplace_back([&, worker, k]
+        {
+            try
+            {
+                if (const auto result = worker->solve_until_deadline(time_limit, find_optimal, incremental,
+                                                                     MEMBERS[k].variable_for_incremental);
+                    result == OPTIMAL || (!find_optimal && result != UNKNOWN))
+                {
+                    answered.store(true, std::memory_order_relaxed);
+                }
+            }
+            catch (...)
+            {
+                errors[k] = std::current_exception();
+                answered.store(true, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto& worker : workers)
+    {
+        worker->shared_bounds = nullptr;
+        worker->sat_solver->set_interrupt({});
+    }
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The smallest coloring of any worker is the result
+    for (int k = 0; k < static_cast<int>(workers.size()); k++)
+    {
+        if (const auto& candidate = workers[k]->coloring;
+            !candidate.empty() && (coloring.empty() || get_coloring_span(candidate) < get_coloring_span(coloring)))
+        {
+            coloring = candidate;
+            winner = k;
+        }
+    }
+    if (coloring.empty() && !heuristic_coloring.empty())
+    {
+        coloring = heuristic_coloring;
+    }
+
+    const bool any_unsatisfiable = std::ranges::any_of(workers, [](const auto& worker)
+    {
+        return worker->status == UNSATISFIABLE;
+    });
+
+    if (!find_optimal)
+    {
+        if (std::ranges::any_of(workers, [](const auto& worker) { return worker->status == SATISFIABLE; }))
+        {
+            status = SATISFIABLE;
+        }
+        else
+        {
+            status = any_unsatisfiable ? UNSATISFIABLE : UNKNOWN;
+        }
+        return status;
+    }
+
+    if (!coloring.empty())
+    {
+        span = get_coloring_span(coloring);
+        status = bounds.get_lower_bound() >= span ? OPTIMAL : SATISFIABLE;
+    }
+    else
+    {
+        status = any_unsatisfiable ? UNSATISFIABLE : UNKNOWN;
+    }
+    return status;
+}
+
+std::unordered_map<std::string, double> BCPSolver::PortfolioMethod::get_statistics() const
+{
+    auto stats = BCPSolver::get_statistics();
+    stats["winner"] = winner;
+    stats["portfolio_threads"] = static_cast<double>(workers.size());
+
+    double encoding = 0;
+    double solving = 0;
+    double time_used = 0;
+    for (std::size_t k = 0; k < workers.size(); k++)
+    {
+        const auto worker_stats = workers[k]->get_statistics();
+        const std::string prefix = "worker" + std::to_string(k) + "_";
+        stats[prefix + "method"] = MEMBERS[k].method;
+        stats[prefix + "status"] = worker_stats.at("status");
+        stats[prefix + "span"] = worker_stats.at("span");
+        stats[prefix + "solves"] = worker_stats.at("solves");
+        stats[prefix + "learned"] = worker_stats.at("learned");
+        stats[prefix + "encoding_time"] = worker_stats.at("encoding_time");
+        stats[prefix + "total_solving_time"] = worker_stats.at("total_solving_time");
+
+        // The workers run side by side, so the portfolio took as long as the slowest of them
+        encoding = std::max(encoding, worker_stats.at("encoding_time"));
+        solving = std::max(solving, worker_stats.at("total_solving_time"));
+        time_used = std::max(time_used, worker_stats.at("time_used"));
+    }
+    stats["encoding_time"] = encoding;
+    stats["total_solving_time"] = solving;
+    stats["time_used"] = time_used;
+
+    return stats;
+}
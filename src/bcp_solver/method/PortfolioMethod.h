@@ -0,0 +1,57 @@
+#ifndef BCP_PORTFOLIOMETHOD_H
+#define BCP_PORTFOLIOMETHOD_H
+#include "bcp_solver/bcp_solver.h"
+
+namespace BCPSolver
+{
+    // Runs several encodings in parallel threads, each on its own CaDiCaL instance. The workers share their best
+    // span and their best infeasibility proof, so every worker searches between the bounds of the whole portfolio
+    // and all of them stop once the bounds meet.
+    class PortfolioMethod : public BCPSolver
+    {
+    private:
+        struct Member
+        {
+            SolvingMethod method;
+            const char* width;
+            const char* variable_for_incremental;
+            bool supports_pairwise;
+        };
+
+        // Workers are taken from the front of this list
+        static constexpr Member MEMBERS[] = {
+            {OneVariableGreater, "", "y", false},
+            {TwoVariablesLess, "", "both", true},
+            {StaircaseWithAuxiliaryVarsWithCache, "vary", "x", true},
+            {StaircaseWithoutAuxiliaryVars, "fixed", "x", true},
+            {TwoVariablesGreater, "", "both", true},
+            {OneVariableLess, "", "y", false},
+        };
+
+        std::vector<std::unique_ptr<BCPSolver>> workers;
+        int winner{-1};
+
+        void encode() override;
+
+        void create_variable() override;
+
+        void encode_edge(int u, int v, int weight) override;
+
+        std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) override;
+
+        SolverStatus solve_until_deadline(double time_limit, bool find_optimal, bool incremental,
+                                          const std::string& variable_for_incremental) override;
+
+        friend class BCPSolver;
+
+        explicit PortfolioMethod(const Graph* graph, int upper_bound, bool use_symmetry_breaking, bool use_heuristic,
+                                 const SolverOptions& options);
+
+    public:
+        static constexpr int MAX_THREADS = std::size(MEMBERS);
+
+        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const override;
+    };
+}
+
+#endif //BCP_PORTFOLIOMETHOD_H
@@ -7,9 +7,10 @@
 
 void BCPSolver::StaircaseWithAuxiliaryVarsMethod::symmetry_breaking()
 {
+    const int vertex = graph->get_highest_degree_vertex();
     for (int c = (span / 2) + 1; c < span + 1; c++)
     {
-        sat_solver->add_clause(-x[{graph->get_highest_degree_vertex(), c}]);
+        sat_solver->add_clause(-x(vertex, c));
     }
 }
 
@@ -24,20 +25,13 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
                 std::vector<int> vars;
                 for (int c = 1; c < span + 1; c++)
                 {
-                    vars.push_back(x[{i, c}]);
+                    vars.push_back(x(i, c));
                 }
                 sat_solver->encode_equals_k(vars, 1);
                 continue;
             }
 
-            int max_weight_of_current_node = 0;
-            for (const auto& neighbor : graph->get_neighbors(i))
-            {
-                if (const int weight = graph->get_weight(i, neighbor); weight > max_weight_of_current_node)
-                {
-                    max_weight_of_current_node = weight;
-                }
-            }
+            const int max_weight_of_current_node = graph->get_max_incident_weight(i);
 
             max_weight[i] = max_weight_of_current_node;
 
@@ -46,7 +40,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
                 std::vector<int> vars;
                 for (int c = 1; c < span + 1; c++)
                 {
-                    vars.push_back(x[{i, c}]);
+                    vars.push_back(x(i, c));
                 }
                 sat_solver->encode_equals_k(vars, 1);
             }
@@ -65,14 +59,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
     }
     else if (width == "fixed")
     {
-        int max_weight_global = 0;
-        for (const auto& [u, v, weight] : graph->get_edges())
-        {
-            if (weight > max_weight_global)
-            {
-                max_weight_global = weight;
-            }
-        }
+        const int max_weight_global = graph->get_max_weight();
         for (int i = 0; i < graph->get_number_of_nodes(); i++)
         {
             if (graph->get_degree(i) == 0)
@@ -80,7 +67,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
                 std::vector<int> vars;
                 for (int c = 1; c < span + 1; c++)
                 {
-                    vars.push_back(x[{i, c}]);
+                    vars.push_back(x(i, c));
                 }
                 sat_solver->encode_equals_k(vars, 1);
                 continue;
@@ -119,7 +106,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
 //             std::vector<int> vars;
 //             for (int c = 1; c < span + 1; c++)
 //             {
-//                 vars.push_back(x[{i, c}]);
+//                 vars.push_back(x(i, c));
 //             }
 //             sat_solver->encode_equals_k(vars, 1);
 //             continue;
@@ -144,7 +131,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
 //         //     std::vector<int> vars;
 //         //     for (int c = 1; c < span + 1; c++)
 //         //     {
-//         //         vars.push_back(x[{i, c}]);
+//         //         vars.push_back(x(i, c));
 //         //     }
 //         //     sat_solver.encode_equals_k(vars, 1);
 //         // }
@@ -165,41 +152,43 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::first_constraint()
 void BCPSolver::StaircaseWithAuxiliaryVarsMethod::second_constraint()
 {
     used_tuple.clear();
-    for (const auto& [u, v, weight] : graph->get_edges())
+    encode_edges();
+}
+
+void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_edge(const int u, const int v, const int weight)
+{
+    for (int c = 1; c < weight; c++)
     {
-        for (int c = 1; c < weight; c++)
+        if (c - weight < 1 && c + weight - 1 > span)
         {
-            if (c - weight < 1 && c + weight - 1 > span)
-            {
-                sat_solver->add_clause(-x[{u, c}]);
-            }
+            sat_solver->add_clause(-x(u, c));
         }
+    }
 
-        if (use_heuristic)
+    if (use_heuristic)
+    {
+        if (weight == 1)
         {
-            if (weight == 1)
+            for (int c = 1; c < span + 1; c++)
             {
-                for (int c = 1; c < span + 1; c++)
-                {
-                    sat_solver->add_clause(-x[{u, c}], -x[{v, c}]);
-                }
-                continue;
+                sat_solver->add_clause(-x(u, c), -x(v, c));
             }
+            return;
         }
+    }
 
-        for (int c = 1; c < span - weight + 2; c++)
-        {
-            const auto groups_for_u = split_range_by_groups(c, c + weight - 1, max_weight[u]);
-            const auto vars_for_u = get_var_for_groups(u, groups_for_u);
-            const auto groups_for_v = split_range_by_groups(c, c + weight - 1, max_weight[v]);
-            const auto vars_for_v = get_var_for_groups(v, groups_for_v);
+    for (int c = 1; c < span - weight + 2; c++)
+    {
+        const auto groups_for_u = split_range_by_groups(c, c + weight - 1, max_weight[u]);
+        const auto vars_for_u = get_var_for_groups(u, groups_for_u);
+        const auto groups_for_v = split_range_by_groups(c, c + weight - 1, max_weight[v]);
+        const auto vars_for_v = get_var_for_groups(v, groups_for_v);
 
-            for (const auto var_u : vars_for_u)
+        for (const auto var_u : vars_for_u)
+        {
+            for (const auto var_v : vars_for_v)
             {
-                for (const auto var_v : vars_for_v)
-                {
-                    sat_solver->add_clause(-var_u, -var_v);
-                }
+                sat_solver->add_clause(-var_u, -var_v);
             }
         }
     }
@@ -224,35 +213,27 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode()
 
 void BCPSolver::StaircaseWithAuxiliaryVarsMethod::create_variable()
 {
-    x.clear();
     staircase_aux_vars.clear();
 
-    for (int i = 0; i < graph->get_number_of_nodes(); i++)
-    {
-        for (int c = 1; c < span + 1; c++)
-        {
-            x.insert(std::pair<std::pair<int, int>, int>({i, c}, sat_solver->create_new_variable()));
-        }
-    }
+    x.assign(sat_solver->create_new_variables(graph->get_number_of_nodes() * span), span);
 }
 
 std::vector<int>* BCPSolver::StaircaseWithAuxiliaryVarsMethod::create_assumptions(
-    const std::string& variable_for_incremental)
+    const std::string& variable_for_incremental, const int limit)
 {
-    if (variable_for_incremental == "x")
+    if (variable_for_incremental != "x")
     {
-        auto* assumptions = new std::vector<int>(graph->get_number_of_nodes());
-
-        for (int i = 0; i < graph->get_number_of_nodes(); i++)
-        {
-            (*assumptions)[i] = -x[{i, span}];
-        }
-        return assumptions;
+        throw std::runtime_error("Invalid variable for incremental in StaircaseMethod.");
     }
-    else
+
+    auto* assumptions = new std::vector<int>();
+    if (limit >= encoded_span)
     {
-        throw std::runtime_error("Invalid variable for incremental in StaircaseMethod.");
+        return assumptions;
     }
+
+    assumptions->push_back(x_color_limit(limit));
+    return assumptions;
 }
 
 int BCPSolver::StaircaseWithAuxiliaryVarsMethod::get_aux_var_for_staircase(
@@ -266,7 +247,7 @@ int BCPSolver::StaircaseWithAuxiliaryVarsMethod::get_aux_var_for_staircase(
 
     if (start == end)
     {
-        return x[{node, start}];
+        return x(node, start);
     }
 
     const auto key = std::make_tuple(node, start, end);
@@ -316,7 +297,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
         {
             int current_color = (window_index + 1) * block_width + 1 - i;
             sat_solver->add_clause(
-                -x[{node, current_color}],
+                -x(node, current_color),
                 get_aux_var_for_staircase(node, current_color, last_color));
 
             sat_solver->add_clause(
@@ -324,7 +305,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                 get_aux_var_for_staircase(node, current_color, last_color));
 
             sat_solver->add_clause(
-                x[{node, current_color}],
+                x(node, current_color),
                 get_aux_var_for_staircase(node, current_color + 1, last_color),
                 -get_aux_var_for_staircase(node, current_color, last_color));
         }
@@ -332,7 +313,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
         for (int i = 2; i < block_width + 1; i++)
         {
             int current_color = (window_index + 1) * block_width + 1 - i;
-            sat_solver->add_clause(-x[{node, current_color}],
+            sat_solver->add_clause(-x(node, current_color),
                                    -get_aux_var_for_staircase(node, current_color + 1, last_color));
         }
     }
@@ -348,7 +329,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                 const int current_color = window_index * block_width + i;
 
                 sat_solver->add_clause(
-                    -x[{node, current_color}],
+                    -x(node, current_color),
                     get_aux_var_for_staircase(node, first_color, current_color));
 
                 sat_solver->add_clause(
@@ -356,11 +337,11 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                     get_aux_var_for_staircase(node, first_color, current_color));
 
                 sat_solver->add_clause(
-                    -x[{node, current_color}],
+                    -x(node, current_color),
                     -get_aux_var_for_staircase(node, first_color, current_color - 1));
 
                 sat_solver->add_clause(
-                    x[{node, current_color}],
+                    x(node, current_color),
                     get_aux_var_for_staircase(node, first_color, current_color - 1),
                     -get_aux_var_for_staircase(node, first_color, current_color));
             }
@@ -372,7 +353,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                 const int current_color = window_index * block_width + i;
 
                 sat_solver->add_clause(
-                    -x[{node, current_color}],
+                    -x(node, current_color),
                     get_aux_var_for_staircase(node, first_color, current_color));
 
                 sat_solver->add_clause(
@@ -380,7 +361,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                     get_aux_var_for_staircase(node, first_color, current_color));
 
                 sat_solver->add_clause(
-                    x[{node, current_color}],
+                    x(node, current_color),
                     get_aux_var_for_staircase(node, first_color, current_color - 1),
                     -get_aux_var_for_staircase(node, first_color, current_color));
             }
@@ -389,7 +370,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
             {
                 const int current_color = window_index * block_width + i;
                 sat_solver->add_clause(
-                    -x[{node, current_color}],
+                    -x(node, current_color),
                     -get_aux_var_for_staircase(node, first_color, current_color - 1));
             }
         }
@@ -404,7 +385,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
             const int current_color = window_index * block_width + i;
 
             sat_solver->add_clause(
-                -x[{node, current_color}],
+                -x(node, current_color),
                 get_aux_var_for_staircase(node, first_color, current_color));
 
             sat_solver->add_clause(
@@ -412,7 +393,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                 get_aux_var_for_staircase(node, first_color, current_color));
 
             sat_solver->add_clause(
-                x[{node, current_color}],
+                x(node, current_color),
                 get_aux_var_for_staircase(node, first_color, current_color - 1),
                 -get_aux_var_for_staircase(node, first_color, current_color));
         }
@@ -421,7 +402,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
         {
             const int current_color = window_index * block_width + i;
             sat_solver->add_clause(
-                -x[{node, current_color}],
+                -x(node, current_color),
                 -get_aux_var_for_staircase(node, first_color, current_color - 1));
         }
 
@@ -432,7 +413,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
             int current_color = (window_index + 1) * block_width + 1 - i;
 
             sat_solver->add_clause(
-                -x[{node, current_color}],
+                -x(node, current_color),
                 get_aux_var_for_staircase(node, current_color, last_color));
 
             sat_solver->add_clause(
@@ -440,7 +421,7 @@ void BCPSolver::StaircaseWithAuxiliaryVarsMethod::encode_window(const int node,
                 get_aux_var_for_staircase(node, current_color, last_color));
 
             sat_solver->add_clause(
-                x[{node, current_color}],
+                x(node, current_color),
                 get_aux_var_for_staircase(node, current_color + 1, last_color),
                 -get_aux_var_for_staircase(node, current_color, last_color));
         }
@@ -670,3 +651,14 @@ std::vector<int> BCPSolver::StaircaseWithAuxiliaryVarsMethod::get_var_for_groups
         get_aux_var_for_staircase(node, group[1].first, group[1].second)
     };
 }
+
+void BCPSolver::StaircaseWithAuxiliaryVarsMethod::set_coloring_phases(const std::vector<int>& colors)
+{
+    BCPSolver::set_coloring_phases(colors);
+    // An auxiliary variable holds when the color of its node lies in its range
+    for (const auto& [key, aux_var] : staircase_aux_vars)
+    {
+        const auto& [node, start, end] = key;
+        sat_solver->set_phase(start <= colors[node] && colors[node] <= end ? aux_var : -aux_var);
+    }
+}
@@ -17,7 +17,7 @@ namespace BCPSolver
         std::map<std::tuple<int, int, int>, int> staircase_aux_vars{};
         std::map<std::tuple<int, int, int, int>, int> used_tuple;
         std::vector<int> max_weight{std::vector(graph->get_number_of_nodes(), 0)};
-        const std::string& width;
+        std::string width;
 
         bool use_cache{};
 
@@ -27,11 +27,15 @@ namespace BCPSolver
 
         virtual void second_constraint();
 
+        void encode_edge(int u, int v, int weight) override;
+
         void encode() override;
 
         void create_variable() override;
 
-        std::vector<int>* create_assumptions(const std::string& variable_for_incremental) override;
+        std::vector<int>* create_assumptions(const std::string& variable_for_incremental, int limit) override;
+
+        void set_coloring_phases(const std::vector<int>& colors) override;
 
         friend class BCPSolver;
 
@@ -41,8 +45,9 @@ namespace BCPSolver
                                                   const bool use_symmetry_breaking,
                                                   const bool use_heuristic,
                                                   const bool use_cache,
-                                                  const std::string& width) :
-            BCPSolver(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic), width(width),
+                                                  const std::string& width,
+                                                  const SolverOptions& options) :
+            BCPSolver(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, options), width(width),
             use_cache(use_cache)
         {
         }
@@ -9,62 +9,64 @@ namespace BCPSolver
     void StaircaseWithoutAuxiliaryVarsMethod::second_constraint()
     {
         used_tuple.clear();
-        for (const auto& [u, v, weight] : graph->get_edges())
+        encode_edges();
+    }
+
+    void StaircaseWithoutAuxiliaryVarsMethod::encode_edge(const int u, const int v, const int weight)
+    {
+        for (int c = 1; c < weight; c++)
         {
-            for (int c = 1; c < weight; c++)
+            if (c - weight < 1 && c + weight - 1 > span)
             {
-                if (c - weight < 1 && c + weight - 1 > span)
-                {
-                    sat_solver->add_clause(-x[{u, c}]);
-                }
+                sat_solver->add_clause(-x(u, c));
             }
+        }
 
-            if (use_heuristic)
+        if (use_heuristic)
+        {
+            if (weight == 1)
             {
-                if (weight == 1)
+                for (int c = 1; c < span + 1; c++)
                 {
-                    for (int c = 1; c < span + 1; c++)
-                    {
-                        sat_solver->add_clause(-x[{u, c}], -x[{v, c}]);
-                    }
-                    continue;
+                    sat_solver->add_clause(-x(u, c), -x(v, c));
                 }
+                return;
             }
+        }
 
-            // 3. Sliding Window Constraints
-            // Python: range(1, self._span - weight + 2) -> [1, span - weight + 1] inclusive
-            for (int c = 1; c <= span - weight + 1; c++)
-            {
-                const int range_start = c;
-                const int range_end = c + weight - 1;
+        // 3. Sliding Window Constraints
+        // Python: range(1, self._span - weight + 2) -> [1, span - weight + 1] inclusive
+        for (int c = 1; c <= span - weight + 1; c++)
+        {
+            const int range_start = c;
+            const int range_end = c + weight - 1;
 
-                // Get variables (literals or pairs) for the windows
-                auto vars_u = get_vars_for_constraint_group(u, range_start, range_end);
-                auto vars_v = get_vars_for_constraint_group(v, range_start, range_end);
+            // Get variables (literals or pairs) for the windows
+            auto vars_u = get_vars_for_constraint_group(u, range_start, range_end);
+            auto vars_v = get_vars_for_constraint_group(v, range_start, range_end);
 
-                // Cartesian Product: u vs v
-                for (const auto& var_u : vars_u)
+            // Cartesian Product: u vs v
+            for (const auto& var_u : vars_u)
+            {
+                for (const auto& var_v : vars_v)
                 {
-                    for (const auto& var_v : vars_v)
+                    std::vector<int> clause;
+
+                    // Helper lambda to expand negative of literal/pair
+                    // If pair is (A, B) representing (A AND NOT B),
+                    // then NEGATION is (NOT A OR B) -> add -A, add B.
+                    auto expand_negative = [&](const std::pair<int, int>& lit)
+                    {
+                        if (lit.first != 0) clause.push_back(-lit.first); // -A
+                        if (lit.second != 0) clause.push_back(lit.second); // +B
+                    };
+
+                    expand_negative(var_u);
+                    expand_negative(var_v);
+
+                    if (!clause.empty())
                     {
-                        std::vector<int> clause;
-
-                        // Helper lambda to expand negative of literal/pair
-                        // If pair is (A, B) representing (A AND NOT B),
-                        // then NEGATION is (NOT A OR B) -> add -A, add B.
-                        auto expand_negative = [&](const std::pair<int, int>& lit)
-                        {
-                            if (lit.first != 0) clause.push_back(-lit.first); // -A
-                            if (lit.second != 0) clause.push_back(lit.second); // +B
-                        };
-
-                        expand_negative(var_u);
-                        expand_negative(var_v);
-
-                        if (!clause.empty())
-                        {
-                            sat_solver->add_clause(clause);
-                        }
+                        sat_solver->add_clause(clause);
                     }
                 }
             }
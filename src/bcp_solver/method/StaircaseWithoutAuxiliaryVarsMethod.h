@@ -18,14 +18,16 @@ namespace BCPSolver
         explicit StaircaseWithoutAuxiliaryVarsMethod(const Graph* graph, const SATSolver::SOLVER solver,
                                                      const int upper_bound,
                                                      const bool use_symmetry_breaking,
-                                                     const bool use_heuristic, const std::string& width) :
+                                                     const bool use_heuristic, const std::string& width,
+                                                     const SolverOptions& options) :
             StaircaseWithAuxiliaryVarsMethod(graph, solver, upper_bound, use_symmetry_breaking, use_heuristic, false,
-                                             width)
+                                             width, options)
         {
         }
 
     protected:
         void second_constraint() override;
+        void encode_edge(int u, int v, int weight) override;
         std::vector<std::pair<int, int>> get_vars_for_constraint_group(int node, int start, int end);
     };
 } // BCPSolver
@@ -0,0 +1,128 @@
+#include "TwoVarsGreaterLazyMethod.h"
+
+#include "sat_solver/Cadical.h"
+
+std::vector<int> BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::assign(
+    const Graph* graph, const VariableTable& x, const VariableTable& y, const int number_of_variables)
+{
+    this->graph = graph;
+    this->x = x;
+    this->y = y;
+    const int span = x.get_number_of_colors();
+    x_index.assign(number_of_variables + 1, 0);
+    emitted.assign(static_cast<std::size_t>(graph->get_number_of_nodes()) * span, false);
+    queued.clear();
+    next_literal = 0;
+
+    // Clauses added during search may only use observed variables, which also keeps y safe from elimination
+    std::vector<int> observed;
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
+    {
+        for (int c = 1; c <= span; c++)
+        {
+            x_index[x(i, c)] = i * span + c;
+            observed.push_back(x(i, c));
+            observed.push_back(y(i, c));
+        }
+    }
+    return observed;
+}
+
+void BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::emit(const int index)
+{
+    const int span = x.get_number_of_colors();
+    const int u = index / span;
+    const int c = index % span + 1;
+    emitted[index] = true;
+
+    // The clauses encode_edge() emits for u colored c, each edge being enforced from its lower endpoint only
+    const auto neighbors = graph->get_neighbors(u);
+    const auto weights = graph->get_neighbor_weights(u);
+    for (std::size_t k = 0; k < neighbors.size(); k++)
+    {
+        const int v = neighbors[k];
+        const int weight = weights[k];
+        if (v < u)
+        {
+            continue;
+        }
+        queued.push_back(-x(u, c));
+        if (c - weight >= 0)
+        {
+            queued.push_back(-y(v, c - weight + 1));
+        }
+        if (c + weight <= span)
+        {
+            queued.push_back(y(v, c + weight));
+        }
+        queued.push_back(0);
+        clauses_added++;
+    }
+}
+
+void BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::notify_assignment(const int lit, bool)
+{
+    if (lit > 0 && lit < static_cast<int>(x_index.size()) && x_index[lit] != 0 && !emitted[x_index[lit] - 1])
+    {
+        emit(x_index[lit] - 1);
+    }
+}
+
+bool BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::cb_check_found_model(const std::vector<int>& model)
+{
+    // Notifications may lag behind; a model is only accepted once every color it uses has its clauses
+    for (const auto lit : model)
+    {
+        notify_assignment(lit, false);
+    }
+    return next_literal == queued.size();
+}
+
+bool BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::cb_has_external_clause()
+{
+    if (next_literal == queued.size())
+    {
+        queued.clear();
+        next_literal = 0;
+        return false;
+    }
+    return true;
+}
+
+int BCPSolver::TwoVarsGreaterLazyMethod::DistancePropagator::cb_add_external_clause_lit()
+{
+    return queued[next_literal++];
+}
+
+void BCPSolver::TwoVarsGreaterLazyMethod::encode()
+{
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    create_variable();
+
+    if (use_symmetry_breaking)
+    {
+        symmetry_breaking();
+    }
+
+    first_constraint();
+    second_constraint();
+    third_constraint();
+
+    const auto observed = propagator.assign(graph, x, y, sat_solver->get_number_of_variables());
+    static_cast<SATSolver::Cadical&>(*sat_solver).connect_propagator(&propagator, observed);
+
+    encoding_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+}
+
+BCPSolver::TwoVarsGreaterLazyMethod::~TwoVarsGreaterLazyMethod()
+{
+    static_cast<SATSolver::Cadical&>(*sat_solver).disconnect_propagator();
+}
+
+std::unordered_map<std::string, double> BCPSolver::TwoVarsGreaterLazyMethod::get_statistics() const
+{
+    auto stats = BCPSolver::get_statistics();
+    stats["lazy_clauses"] = static_cast<double>(propagator.clauses_added);
+    return stats;
+}
@@ -0,0 +1,73 @@
+#ifndef BCP_TWOVARSGREATERLAZYMETHOD_H
+#define BCP_TWOVARSGREATERLAZYMETHOD_H
+#include "TwoVarsGreaterMethod.h"
+#include "cadical.hpp"
+
+namespace BCPSolver
+{
+    // 2G encoding without the distance clauses. A CaDiCaL external propagator adds the distance clauses of a vertex
+    // and color the first time the search gives the vertex that color, so the formula only grows with the colors the
+    // search actually tries.
+    class TwoVarsGreaterLazyMethod : public TwoVarsGreaterMethod
+    {
+    private:
+        class DistancePropagator final : public CaDiCaL::ExternalPropagator
+        {
+        private:
+            const Graph* graph{};
+            VariableTable x{};
+            VariableTable y{};
+            // (vertex, color) index + 1 of every x variable, 0 for the other variables
+            std::vector<int> x_index;
+            std::vector<bool> emitted;
+            // Clauses not yet handed to the solver, each closed by a 0
+            std::vector<int> queued;
+            std::size_t next_literal{};
+
+            void emit(int index);
+
+        public:
+            long long clauses_added{};
+
+            // Starts over on a new encoding; returns the variables to observe
+            std::vector<int> assign(const Graph* graph, const VariableTable& x, const VariableTable& y,
+                                    int number_of_variables);
+
+            void notify_assignment(int lit, bool is_fixed) override;
+
+            void notify_new_decision_level() override
+            {
+            }
+
+            void notify_backtrack(size_t) override
+            {
+            }
+
+            bool cb_check_found_model(const std::vector<int>& model) override;
+
+            bool cb_has_external_clause() override;
+
+            int cb_add_external_clause_lit() override;
+        };
+
+        DistancePropagator propagator;
+
+        void encode() override;
+
+        friend class BCPSolver;
+
+        explicit TwoVarsGreaterLazyMethod(const Graph* graph, const int upper_bound,
+                                          const bool use_symmetry_breaking,
+                                          const SolverOptions& options) : TwoVarsGreaterMethod(
+            graph, SATSolver::CADICAL, upper_bound, use_symmetry_breaking, false, options)
+        {
+        }
+
+    public:
+        ~TwoVarsGreaterLazyMethod() override;
+
+        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const override;
+    };
+}
+
+#endif //BCP_TWOVARSGREATERLAZYMETHOD_H
@@ -6,7 +6,7 @@
 
 void BCPSolver::TwoVarsGreaterMethod::symmetry_breaking()
 {
-    sat_solver->add_clause(-y[{graph->get_highest_degree_vertex(), span / 2 + 1}]);
+    sat_solver->add_clause(-y(graph->get_highest_degree_vertex(), span / 2 + 1));
 }
 
 void BCPSolver::TwoVarsGreaterMethod::first_constraint()
@@ -17,14 +17,14 @@ void BCPSolver::TwoVarsGreaterMethod::first_constraint()
         {
             if (c == span)
             {
-                sat_solver->add_clause(-x[{i, c}], y[{i, c}]);
-                sat_solver->add_clause(x[{i, c}], -y[{i, c}]);
+                sat_solver->add_clause(-x(i, c), y(i, c));
+                sat_solver->add_clause(x(i, c), -y(i, c));
             }
             else
             {
-                sat_solver->add_clause(-x[{i, c}], y[{i, c}]);
-                sat_solver->add_clause(-x[{i, c}], -y[{i, c + 1}]);
-                sat_solver->add_clause(x[{i, c}], -y[{i, c}], y[{i, c + 1}]);
+                sat_solver->add_clause(-x(i, c), y(i, c));
+                sat_solver->add_clause(-x(i, c), -y(i, c + 1));
+                sat_solver->add_clause(x(i, c), -y(i, c), y(i, c + 1));
             }
         }
     }
@@ -34,7 +34,7 @@ void BCPSolver::TwoVarsGreaterMethod::second_constraint()
 {
     for (int i = 0; i < graph->get_number_of_nodes(); i++)
     {
-        sat_solver->add_clause(y[{i, 1}]);
+        sat_solver->add_clause(y(i, 1));
     }
 }
 
@@ -44,53 +44,49 @@ void BCPSolver::TwoVarsGreaterMethod::third_constraint()
     {
         for (int c = 2; c < span + 1; c++)
         {
-            sat_solver->add_clause(-y[{i, c}], y[{i, c - 1}]);
+            sat_solver->add_clause(-y(i, c), y(i, c - 1));
         }
     }
 }
 
-void BCPSolver::TwoVarsGreaterMethod::fourth_constraint()
+void BCPSolver::TwoVarsGreaterMethod::encode_edge(const int u, const int v, const int weight)
 {
-    for (const auto& edge : graph->get_edges())
+    if (use_heuristic)
     {
-        auto [u, v, weight] = edge;
-        if (use_heuristic)
+        if (weight == 1)
         {
-            if (weight == 1)
+            for (int c = 1; c <= span; c++)
             {
-                for (int c = 1; c <= span; c++)
+                if (c - 1 < 0 && c + 1 > span)
                 {
-                    if (c - 1 < 0 && c + 1 > span)
-                    {
-                        sat_solver->add_clause(-x[{u, c}]);
-                    }
-                    else
-                    {
-                        sat_solver->add_clause(-x[{u, c}], -x[{v, c}]);
-                    }
+                    sat_solver->add_clause(-x(u, c));
+                }
+                else
+                {
+                    sat_solver->add_clause(-x(u, c), -x(v, c));
                 }
-                continue;
             }
+            return;
         }
+    }
 
-        for (int c = 1; c <= span; c++)
+    for (int c = 1; c <= span; c++)
+    {
+        if (c - weight < 0 && c + weight > span)
         {
-            if (c - weight < 0 && c + weight > span)
-            {
-                sat_solver->add_clause(-x[{u, c}]);
-            }
-            else if (c - weight < 0)
-            {
-                sat_solver->add_clause(-x[{u, c}], y[{v, c + weight}]);
-            }
-            else if (c + weight > span)
-            {
-                sat_solver->add_clause(-x[{u, c}], -y[{v, c - weight + 1}]);
-            }
-            else
-            {
-                sat_solver->add_clause(-x[{u, c}], y[{v, c + weight}], -y[{v, c - weight + 1}]);
-            }
+            sat_solver->add_clause(-x(u, c));
+        }
+        else if (c - weight < 0)
+        {
+            sat_solver->add_clause(-x(u, c), y(v, c + weight));
+        }
+        else if (c + weight > span)
+        {
+            sat_solver->add_clause(-x(u, c), -y(v, c - weight + 1));
+        }
+        else
+        {
+            sat_solver->add_clause(-x(u, c), y(v, c + weight), -y(v, c - weight + 1));
         }
     }
 }
@@ -109,61 +105,58 @@ void BCPSolver::TwoVarsGreaterMethod::encode()
     first_constraint();
     second_constraint();
     third_constraint();
-    fourth_constraint();
+    encode_edges();
 
     encoding_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
 }
 
 void BCPSolver::TwoVarsGreaterMethod::create_variable()
 {
-    x.clear();
-    y.clear();
-
-    for (int i = 0; i < graph->get_number_of_nodes(); i++)
-    {
-        for (int c = 1; c < span + 1; c++)
-        {
-            x.insert(std::pair<std::pair<int, int>, int>({i, c}, sat_solver->create_new_variable()));
-            y.insert(std::pair<std::pair<int, int>, int>({i, c}, sat_solver->create_new_variable()));
-        }
-    }
+    // x(i, c) and y(i, c) are adjacent variables
+    const int first = sat_solver->create_new_variables(2 * graph->get_number_of_nodes() * span);
+    x.assign(first, span, 2);
+    y.assign(first + 1, span, 2);
 }
 
-std::vector<int>* BCPSolver::TwoVarsGreaterMethod::create_assumptions(const std::string& variable_for_incremental)
+std::vector<int>* BCPSolver::TwoVarsGreaterMethod::create_assumptions(
+    const std::string& variable_for_incremental, const int limit)
 {
-    if (variable_for_incremental == "y")
+    const bool use_y = variable_for_incremental == "y" || variable_for_incremental == "both";
+    const bool use_x = variable_for_incremental == "x" || variable_for_incremental == "both";
+    if (!use_x && !use_y)
     {
-        auto* assumptions = new std::vector<int>(graph->get_number_of_nodes());
+        throw std::runtime_error("Invalid variable for incremental in TwoVarsGreaterMethod.");
+    }
 
-        for (int i = 0; i < graph->get_number_of_nodes(); i++)
-        {
-            (*assumptions)[i] = -y[{i, span}];
-        }
+    auto* assumptions = new std::vector<int>();
+    if (limit >= encoded_span)
+    {
         return assumptions;
     }
-    else if (variable_for_incremental == "x")
-    {
-        auto* assumptions = new std::vector<int>(graph->get_number_of_nodes());
 
+    if (use_y)
+    {
+        // y(i, c) means color >= c
         for (int i = 0; i < graph->get_number_of_nodes(); i++)
         {
-            (*assumptions)[i] = -x[{i, span}];
+            assumptions->push_back(-y(i, limit + 1));
         }
-        return assumptions;
     }
-    else if (variable_for_incremental == "both")
+    if (use_x)
     {
-        auto* assumptions = new std::vector<int>(graph->get_number_of_nodes());
+        assumptions->push_back(x_color_limit(limit));
+    }
+    return assumptions;
+}
 
-        for (int i = 0; i < graph->get_number_of_nodes(); i++)
+void BCPSolver::TwoVarsGreaterMethod::set_coloring_phases(const std::vector<int>& colors)
+{
+    BCPSolver::set_coloring_phases(colors);
+    for (int i = 0; i < graph->get_number_of_nodes(); i++)
+    {
+        for (int c = 1; c <= y.get_number_of_colors(); c++)
         {
-            (*assumptions)[i] = -x[{i, span}];
-            (*assumptions)[i] = -y[{i, span}];
+            sat_solver->set_phase(c <= colors[i] ? y(i, c) : -y(i, c));
         }
-        return assumptions;
-    }
-    else
-    {
-        throw std::runtime_error("Invalid variable for incremental in TwoVarsGreaterMethod.");
     }
 }
@@ -0,0 +1,53 @@
+#ifndef BCP_SHARED_BOUNDS_H
+#define BCP_SHARED_BOUNDS_H
+
+#include <atomic>
+
+namespace BCPSolver
+{
+    // Span bounds shared by the workers of a portfolio. Updates only ever tighten them, so they are plain atomics
+    // lowered or raised with compare-and-swap.
+    class SharedBounds
+    {
+    private:
+        // Smallest span some worker has a coloring for
+        std::atomic<int> best_span;
+        // Smallest span not yet proven infeasible
+        std::atomic<int> lower_bound;
+
+    public:
+        SharedBounds(const int best_span, const int lower_bound) : best_span(best_span), lower_bound(lower_bound)
+        {
+        }
+
+        [[nodiscard]] int get_best_span() const { return best_span.load(std::memory_order_acquire); }
+
+        [[nodiscard]] int get_lower_bound() const { return lower_bound.load(std::memory_order_acquire); }
+
+        void offer_span(const int span)
+        {
+            int current = get_best_span();
+            while (span < current && !best_span.compare_exchange_weak(current, span, std::memory_order_acq_rel))
+            {
+            }
+        }
+
+        void offer_lower_bound(const int bound)
+        {
+            int current = get_lower_bound();
+            while (bound > current && !lower_bound.compare_exchange_weak(current, bound, std::memory_order_acq_rel))
+            {
+            }
+        }
+
+        [[nodiscard]] bool is_optimal() const { return get_lower_bound() >= get_best_span(); }
+
+        // Whether the bounds already answer a probe at this span
+        [[nodiscard]] bool settles(const int span) const
+        {
+            return get_best_span() <= span || get_lower_bound() > span;
+        }
+    };
+} // namespace BCPSolver
+
+#endif //BCP_SHARED_BOUNDS_H
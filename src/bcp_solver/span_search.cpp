@@ -0,0 +1,73 @@
+#include "span_search.h"
+
+#include <algorithm>
+#include <bit>
+
+BCPSolver::SpanSearch::SpanSearch(const SearchStrategy strategy, const int lower_bound, const int feasible_span)
+    : strategy(strategy), infeasible(std::max(lower_bound, 1) - 1), unresolved(infeasible), feasible(feasible_span)
+{
+}
+
+int BCPSolver::SpanSearch::next() const
+{
+    const int middle = unresolved + (feasible - unresolved) / 2;
+    switch (strategy)
+    {
+    case Ascending:
+        return unresolved + 1;
+    case BinarySearch:
+        return middle;
+    case Galloping:
+        return bisecting ? middle : std::max(unresolved + 1, feasible - gallop_step);
+    case Adaptive:
+        return bisecting ? middle : feasible - 1;
+    default:
+        return feasible - 1;
+    }
+}
+
+int BCPSolver::SpanSearch::estimated_probes() const
+{
+    const int gap = std::max(candidates(), 1);
+    const int bisections = std::bit_width(static_cast<unsigned>(gap));
+    switch (strategy)
+    {
+    case BinarySearch:
+    case Galloping:
+        return bisections;
+    case Adaptive:
+        return bisecting ? bisections : std::min(gap, 2 * bisections);
+    default:
+        return gap;
+    }
+}
+
+void BCPSolver::SpanSearch::record(const int span, const int result, const double probe_time,
+                                   const double remaining_time)
+{
+    if (strategy == Adaptive && !bisecting)
+    {
+        // Descending one span at a time can afford about remaining_time / candidates per probe
+        bisecting = remaining_time == NO_TIME_LIMIT
+                        ? probe_time > ADAPTIVE_PROBE_TIME
+                        : probe_time * candidates() > remaining_time;
+    }
+
+    if (result == SATISFIABLE)
+    {
+        feasible = std::min(feasible, span);
+        gallop_step *= 2;
+        return;
+    }
+
+    if (result == UNSATISFIABLE)
+    {
+        // Every smaller span is infeasible as well
+        infeasible = std::max(infeasible, span);
+    }
+    unresolved = std::max({unresolved, infeasible, span});
+    if (strategy == Galloping)
+    {
+        bisecting = true;
+    }
+}
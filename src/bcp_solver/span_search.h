@@ -0,0 +1,57 @@
+#ifndef BCP_SPAN_SEARCH_H
+#define BCP_SPAN_SEARCH_H
+
+#include "utility.h"
+
+namespace BCPSolver
+{
+    // Chooses the spans probed by the optimal solving loop. The search keeps the largest span proven infeasible and
+    // the smallest span with a coloring and always probes strictly between them:
+    //  - LinearDescending probes right below the feasible span,
+    //  - Ascending probes right above the infeasible span,
+    //  - BinarySearch probes the middle,
+    //  - Galloping steps down by 1, 2, 4, ... from the feasible span and bisects once a probe fails,
+    //  - Adaptive descends linearly and bisects once a probe takes longer than its share of the time.
+    //
+    // A probe that runs out of time narrows the search like an infeasible one but proves nothing, so the result is
+    // only optimal when the bounds meet through proofs.
+    class SpanSearch
+    {
+    private:
+        // Probes slower than this switch Adaptive to bisection when there is no time limit
+        static constexpr double ADAPTIVE_PROBE_TIME = 1.0;
+
+        SearchStrategy strategy;
+        int infeasible;
+        int unresolved;
+        int feasible;
+        int gallop_step{1};
+        bool bisecting{false};
+
+        [[nodiscard]] int candidates() const { return feasible - unresolved - 1; }
+
+    public:
+        SpanSearch(SearchStrategy strategy, int lower_bound, int feasible_span);
+
+        [[nodiscard]] bool done() const { return candidates() <= 0; }
+
+        [[nodiscard]] bool is_optimal() const { return feasible - 1 <= infeasible; }
+
+        [[nodiscard]] int get_feasible() const { return feasible; }
+
+        [[nodiscard]] int get_infeasible() const { return infeasible; }
+
+        [[nodiscard]] int next() const;
+
+        // Probes the strategy still expects to make; the remaining time is split evenly across them.
+        [[nodiscard]] int estimated_probes() const;
+
+        // result is SATISFIABLE, UNSATISFIABLE or UNKNOWN; remaining_time is the budget left before the probe.
+        void record(int span, int result, double probe_time, double remaining_time);
+
+        // Reopens the spans whose probes ran out of time.
+        void retry_unresolved() { unresolved = infeasible; }
+    };
+} // namespace BCPSolver
+
+#endif //BCP_SPAN_SEARCH_H
@@ -4,15 +4,111 @@
 
 #include "utility.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <numeric>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "sat_solver/ClauseExchange.h"
 
 void BCPSolver::Graph::add_edge(const int i, const int j, const int w)
 {
     edges_list.emplace_back(i, j, w);
-    matrix[i][j] = w;
-    matrix[j][i] = w;
+}
+
+void BCPSolver::Graph::reserve_edges(const int m)
+{
+    edges_list.reserve(m);
+}
+
+void BCPSolver::Graph::build_adjacency()
+{
+    std::vector<int> row_start(n + 1, 0);
+    for (const auto& [u, v, w] : edges_list)
+    {
+        row_start[u + 1]++;
+        row_start[v + 1]++;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        row_start[i + 1] += row_start[i];
+    }
+
+    std::vector<std::pair<int, int>> entries(row_start[n]);
+    std::vector<int> fill(row_start.begin(), row_start.end() - 1);
+    for (const auto& [u, v, w] : edges_list)
+    {
+        entries[fill[u]++] = {v, w};
+        entries[fill[v]++] = {u, w};
+    }
+
+    neighbors.clear();
+    weights.clear();
+    neighbors.reserve(entries.size());
+    weights.reserve(entries.size());
+
+    for (int u = 0; u < n; u++)
+    {
+        const auto row_begin = entries.begin() + row_start[u];
+        const auto row_end = entries.begin() + row_start[u + 1];
+        // Sorting by (neighbor, weight) puts the largest weight of a repeated edge last in its run
+        std::sort(row_begin, row_end);
+
+        offsets[u] = static_cast<int>(neighbors.size());
+        for (auto it = row_begin; it != row_end; ++it)
+        {
+            // A zero weight imposes no distance, so such an edge is not an adjacency.
+            if (const auto next = it + 1; (next != row_end && next->first == it->first) || it->second == 0)
+            {
+                continue;
+            }
+            neighbors.push_back(it->first);
+            weights.push_back(it->second);
+        }
+    }
+    offsets[n] = static_cast<int>(neighbors.size());
+
+    compute_invariants();
+}
+
+void BCPSolver::Graph::assign_adjacency(std::vector<int> row_offsets, std::vector<int> row_neighbors,
+                                        std::vector<int> row_weights)
+{
+    offsets = std::move(row_offsets);
+    neighbors = std::move(row_neighbors);
+    weights = std::move(row_weights);
+
+    compute_invariants();
+}
+
+void BCPSolver::Graph::compute_invariants()
+{
+    weighted_degrees.assign(n, 0);
+    max_incident_weights.assign(n, 0);
+    max_weight = 0;
+    for (int u = 0; u < n; u++)
+    {
+        for (const int w : get_neighbor_weights(u))
+        {
+            weighted_degrees[u] += w;
+            max_incident_weights[u] = std::max(max_incident_weights[u], w);
+        }
+        max_weight = std::max(max_weight, max_incident_weights[u]);
+    }
+
+    degree_order.resize(n);
+    std::iota(degree_order.begin(), degree_order.end(), 0);
+    std::stable_sort(degree_order.begin(), degree_order.end(),
+                     [this](const int a, const int b) { return get_degree(a) > get_degree(b); });
 }
 
 const std::vector<std::tuple<int, int, int>>& BCPSolver::Graph::get_edges() const
@@ -20,9 +116,14 @@ const std::vector<std::tuple<int, int, int>>& BCPSolver::Graph::get_edges() cons
     return edges_list;
 }
 
-int BCPSolver::Graph::get_weight(int i, int j) const
+int BCPSolver::Graph::get_weight(const int i, const int j) const
 {
-    return matrix[i][j];
+    const auto row = get_neighbors(i);
+    if (const auto it = std::lower_bound(row.begin(), row.end(), j); it != row.end() && *it == j)
+    {
+        return weights[offsets[i] + (it - row.begin())];
+    }
+    return 0;
 }
 
 int BCPSolver::Graph::get_number_of_nodes() const
@@ -37,108 +138,503 @@ int BCPSolver::Graph::get_number_of_edges() const
 
 int BCPSolver::Graph::get_highest_degree_vertex() const
 {
-    if (n == 0)
+    return degree_order.empty() ? -1 : degree_order.front();
+}
+
+int BCPSolver::Graph::get_degree(const int node) const
+{
+    if (node < 0 || node >= n)
     {
-        return -1;
+        throw std::out_of_range("Node index out of bounds");
     }
 
-    std::vector degrees(n, 0);
+    return offsets[node + 1] - offsets[node];
+}
 
-    for (const auto& edge : edges_list)
-    {
-        degrees[std::get<0>(edge)]++;
-        degrees[std::get<1>(edge)]++;
-    }
+int BCPSolver::Graph::get_weighted_degree(const int node) const
+{
+    return weighted_degrees[node];
+}
+
+int BCPSolver::Graph::get_max_incident_weight(const int node) const
+{
+    return max_incident_weights[node];
+}
 
-    int max_degree = -1;
-    int max_vertex = -1;
+int BCPSolver::Graph::get_max_weight() const
+{
+    return max_weight;
+}
 
-    for (int i = 0; i < n; ++i)
+const std::vector<int>& BCPSolver::Graph::get_degree_order() const
+{
+    return degree_order;
+}
+
+namespace
+{
+    // Read-only view of a whole file, memory-mapped where the platform allows it.
+    class MappedFile
     {
-        if (degrees[i] > max_degree)
+    private:
+        const char* bytes{};
+        std::size_t length{};
+        bool opened{};
+#ifdef _WIN32
+        std::string buffer;
+#endif
+
+    public:
+        explicit MappedFile(const std::string& path)
+        {
+#ifdef _WIN32
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open())
+            {
+                return;
+            }
+            buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            bytes = buffer.data();
+            length = buffer.size();
+            opened = true;
+#else
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                return;
+            }
+
+            struct stat info{};
+            if (fstat(fd, &info) != 0)
+            {
+                close(fd);
+                return;
+            }
+
+            length = static_cast<std::size_t>(info.st_size);
+            if (length > 0)
+            {
+                void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping == MAP_FAILED)
+                {
+                    close(fd);
+                    return;
+                }
+                madvise(mapping, length, MADV_SEQUENTIAL);
+                bytes = static_cast<const char*>(mapping);
+            }
+            close(fd);
+            opened = true;
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile()
         {
-            max_degree = degrees[i];
-            max_vertex = i;
+#ifndef _WIN32
+            if (bytes != nullptr)
+            {
+                munmap(const_cast<char*>(bytes), length);
+            }
+#endif
         }
-    }
 
-    return max_vertex;
-}
+        [[nodiscard]] bool is_open() const { return opened; }
 
-int BCPSolver::Graph::get_degree(const int node) const
-{
-    if (node < 0 || node >= n)
+        [[nodiscard]] const char* begin() const { return bytes; }
+
+        [[nodiscard]] const char* end() const { return bytes + length; }
+    };
+
+    // Hand-written scanner over the raw bytes of a DIMACS .col file. Only spaces, tabs and carriage returns
+    // separate tokens; a newline always ends the current line.
+    class ColScanner
     {
-        throw std::out_of_range("Node index out of bounds");
-    }
+    private:
+        const char* first;
+        const char* p;
+        const char* last;
+
+        static bool is_blank(const char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+    public:
+        ColScanner(const char* begin, const char* end) : first(begin), p(begin), last(end)
+        {
+        }
+
+        [[nodiscard]] bool at_end() const { return p == last; }
+
+        [[nodiscard]] bool at_line_end() const { return p == last || *p == '\n'; }
+
+        [[nodiscard]] std::size_t offset() const { return static_cast<std::size_t>(p - first); }
+
+        char next() { return *p++; }
+
+        void skip_blanks()
+        {
+            while (p != last && is_blank(*p))
+            {
+                ++p;
+            }
+        }
+
+        void skip_line()
+        {
+            const void* newline = p == last ? nullptr : std::memchr(p, '\n', last - p);
+            p = newline == nullptr ? last : static_cast<const char*>(newline) + 1;
+        }
+
+        bool skip_word()
+        {
+            skip_blanks();
+            const char* start = p;
+            while (!at_line_end() && !is_blank(*p))
+            {
+                ++p;
+            }
+            return p != start;
+        }
+
+        bool read_int(int& value)
+        {
+            skip_blanks();
+            const char* start = p;
+            const bool negative = p != last && *p == '-';
+            if (negative)
+            {
+                ++p;
+            }
+
+            long long result = 0;
+            const char* digits = p;
+            while (p != last && *p >= '0' && *p <= '9')
+            {
+                result = result * 10 + (*p - '0');
+                if (result > std::numeric_limits<int>::max())
+                {
+                    p = start;
+                    return false;
+                }
+                ++p;
+            }
+
+            if (p == digits || (!at_line_end() && !is_blank(*p)))
+            {
+                p = start;
+                return false;
+            }
+
+            value = static_cast<int>(negative ? -result : result);
+            return true;
+        }
+    };
 
-    int degree = 0;
-    for (const int weight : matrix[node])
+    BCPSolver::Graph* parse_col_graph(const MappedFile& file, const std::string& file_path)
     {
-        if (weight != 0)
+        using BCPSolver::Graph;
+
+        ColScanner scanner(file.begin(), file.end());
+        Graph* g = nullptr;
+
+        auto malformed = [&](const std::size_t line_offset, const char* reason) -> Graph*
+        {
+            std::cerr << "Error: " << reason << " in line at byte offset " << line_offset << " of " << file_path
+                << std::endl;
+            delete g;
+            return nullptr;
+        };
+
+        while (!scanner.at_end())
+        {
+            scanner.skip_blanks();
+            const std::size_t line_offset = scanner.offset();
+
+            if (scanner.at_line_end())
+            {
+                scanner.skip_line();
+                continue;
+            }
+
+            const char line_type = scanner.next();
+
+            if (line_type == 'p')
+            {
+                if (g != nullptr)
+                {
+                    return malformed(line_offset, "duplicate problem line");
+                }
+
+                int num_nodes;
+                int num_edges;
+                if (!scanner.skip_word() || !scanner.read_int(num_nodes) || num_nodes < 0)
+                {
+                    return malformed(line_offset, "malformed problem line");
+                }
+
+                g = new Graph(num_nodes);
+
+                // The edge count is optional; when present it counts the node-weight self-loops as well.
+                if (scanner.read_int(num_edges) && num_edges > 0)
+                {
+                    g->reserve_edges(num_edges);
+                }
+            }
+            else if (line_type == 'e')
+            {
+                if (g == nullptr)
+                {
+                    return malformed(line_offset, "edge before problem line");
+                }
+
+                int u, v, w;
+                if (!scanner.read_int(u) || !scanner.read_int(v) || !scanner.read_int(w))
+                {
+                    return malformed(line_offset, "malformed edge line");
+                }
+
+                if (u < 1 || u > g->get_number_of_nodes() || v < 1 || v > g->get_number_of_nodes())
+                {
+                    return malformed(line_offset, "vertex out of range");
+                }
+
+                if (u != v)
+                {
+                    g->add_edge(u - 1, v - 1, w);
+                }
+            }
+
+            scanner.skip_line();
+        }
+
+        if (g != nullptr)
         {
-            degree++;
+            g->build_adjacency();
         }
+        return g;
     }
 
-    return degree;
-}
+    // Binary graph file, in native byte order:
+    //   BinaryGraphHeader
+    //   int32 offsets[n + 1], int32 neighbors[adjacency_size], int32 weights[adjacency_size]
+    //   int32 edges[3 * number_of_edges] as (u, v, w) triples with 0-based vertices
+    // The checksum covers everything after the header.
+    constexpr char BINARY_GRAPH_MAGIC[4] = {'B', 'C', 'P', 'G'};
+    constexpr std::uint32_t BINARY_GRAPH_VERSION = 1;
 
-BCPSolver::Graph* BCPSolver::read_bcp_graph(const std::string& file_path)
-{
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    struct BinaryGraphHeader
     {
-        std::cerr << "Error: Could not open file " << file_path << std::endl;
-        return nullptr;
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t number_of_nodes;
+        std::uint32_t reserved;
+        std::uint64_t number_of_edges;
+        std::uint64_t adjacency_size;
+        std::uint64_t checksum;
+    };
+
+    static_assert(sizeof(BinaryGraphHeader) == 40);
+
+    // FNV-1a over 64-bit words, with the trailing bytes folded in one at a time.
+    std::uint64_t binary_graph_checksum(const char* data, const std::size_t length)
+    {
+        constexpr std::uint64_t prime = 0x100000001b3ULL;
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= length; i += sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+        }
+        for (; i < length; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+        }
+        return hash;
     }
 
-    Graph* g = nullptr;
-    std::string line;
+    bool is_binary_graph(const MappedFile& file)
+    {
+        return static_cast<std::size_t>(file.end() - file.begin()) >= sizeof(BINARY_GRAPH_MAGIC) &&
+            std::memcmp(file.begin(), BINARY_GRAPH_MAGIC, sizeof(BINARY_GRAPH_MAGIC)) == 0;
+    }
 
-    while (std::getline(file, line))
+    BCPSolver::Graph* load_binary_graph(const MappedFile& file, const std::string& file_path)
     {
-        if (line.empty())
-            continue;
+        const auto length = static_cast<std::size_t>(file.end() - file.begin());
 
-        std::stringstream ss(line);
-        char line_type;
-        ss >> line_type;
+        auto invalid = [&](const char* reason) -> BCPSolver::Graph*
+        {
+            std::cerr << "Error: " << reason << " in binary graph " << file_path << std::endl;
+            return nullptr;
+        };
 
-        if (line_type == 'p')
+        if (length < sizeof(BinaryGraphHeader))
         {
-            std::string ignore;
-            int num_nodes;
-            ss >> ignore >> num_nodes;
+            return invalid("truncated header");
+        }
+
+        BinaryGraphHeader header{};
+        std::memcpy(&header, file.begin(), sizeof(header));
 
-            g = new Graph(num_nodes);
+        if (header.version != BINARY_GRAPH_VERSION)
+        {
+            return invalid("unsupported version");
         }
-        else if (line_type == 'e')
+
+        // Bounded by INT_MAX, the sizes below cannot overflow 64 bits
+        constexpr auto max_count = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+        if (header.number_of_nodes > max_count || header.adjacency_size > max_count ||
+            header.number_of_edges > max_count)
         {
-            if (g == nullptr)
-                continue;
+            return invalid("size mismatch");
+        }
+        const std::uint64_t n = header.number_of_nodes;
+        const std::uint64_t payload_ints = (n + 1) + 2 * header.adjacency_size + 3 * header.number_of_edges;
+        if (length != sizeof(BinaryGraphHeader) + payload_ints * sizeof(std::int32_t))
+        {
+            return invalid("size mismatch");
+        }
+
+        const char* payload = file.begin() + sizeof(BinaryGraphHeader);
+        if (binary_graph_checksum(payload, length - sizeof(BinaryGraphHeader)) != header.checksum)
+        {
+            return invalid("checksum mismatch");
+        }
 
-            int u, v, w;
-            ss >> u >> v >> w;
+        const auto* ints = reinterpret_cast<const std::int32_t*>(payload);
+        const auto* offsets = ints;
+        const auto* neighbors = offsets + (n + 1);
+        const auto* weights = neighbors + header.adjacency_size;
+        const auto* edges = weights + header.adjacency_size;
 
-            if (u != v)
+        if (offsets[0] != 0 || static_cast<std::uint64_t>(offsets[n]) != header.adjacency_size ||
+            !std::is_sorted(offsets, offsets + n + 1))
+        {
+            return invalid("corrupt offsets");
+        }
+
+        const auto node_count = static_cast<std::int32_t>(n);
+        for (std::uint64_t k = 0; k < header.adjacency_size; k++)
+        {
+            if (neighbors[k] < 0 || neighbors[k] >= node_count || weights[k] < 0)
             {
-                g->add_edge(u - 1, v - 1, w);
+                return invalid("corrupt adjacency");
             }
         }
+
+        // Every edge has to appear with its weight in the rows of both endpoints
+        auto in_row = [&](const std::int32_t u, const std::int32_t v, const std::int32_t w)
+        {
+            const auto* first = neighbors + offsets[u];
+            const auto* last = neighbors + offsets[u + 1];
+            const auto* it = std::lower_bound(first, last, v);
+            return it != last && *it == v && weights[it - neighbors] == w;
+        };
+        for (std::uint64_t e = 0; e < header.number_of_edges; e++)
+        {
+            const std::int32_t u = edges[3 * e];
+            const std::int32_t v = edges[3 * e + 1];
+            const std::int32_t w = edges[3 * e + 2];
+            if (u < 0 || u >= node_count || v < 0 || v >= node_count || w < 0 || !in_row(u, v, w) ||
+                !in_row(v, u, w))
+            {
+                return invalid("corrupt edge list");
+            }
+        }
+
+        auto* g = new BCPSolver::Graph(static_cast<int>(n));
+        g->reserve_edges(static_cast<int>(header.number_of_edges));
+        for (std::uint64_t e = 0; e < header.number_of_edges; e++)
+        {
+            g->add_edge(edges[3 * e], edges[3 * e + 1], edges[3 * e + 2]);
+        }
+        g->assign_adjacency(std::vector<int>(offsets, offsets + n + 1),
+                            std::vector<int>(neighbors, neighbors + header.adjacency_size),
+                            std::vector<int>(weights, weights + header.adjacency_size));
+        return g;
+    }
+} // namespace
+
+BCPSolver::Graph* BCPSolver::read_bcp_graph(const std::string& file_path)
+{
+    const MappedFile file(file_path);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open file " << file_path << std::endl;
+        return nullptr;
+    }
+
+    if (is_binary_graph(file))
+    {
+        return load_binary_graph(file, file_path);
+    }
+    return parse_col_graph(file, file_path);
+}
+
+bool BCPSolver::write_binary_graph(const Graph& graph, const std::string& file_path)
+{
+    const int n = graph.get_number_of_nodes();
+    const auto& edges = graph.get_edges();
+
+    std::vector<std::int32_t> offsets(n + 1, 0);
+    for (int u = 0; u < n; u++)
+    {
+        offsets[u + 1] = offsets[u] + graph.get_degree(u);
+    }
+
+    std::vector<std::int32_t> payload;
+    payload.reserve(offsets.size() + 2 * static_cast<std::size_t>(offsets[n]) + 3 * edges.size());
+    payload.insert(payload.end(), offsets.begin(), offsets.end());
+    for (int u = 0; u < n; u++)
+    {
+        const auto row = graph.get_neighbors(u);
+        payload.insert(payload.end(), row.begin(), row.end());
+    }
+    for (int u = 0; u < n; u++)
+    {
+        const auto row = graph.get_neighbor_weights(u);
+        payload.insert(payload.end(), row.begin(), row.end());
+    }
+    for (const auto& [u, v, w] : edges)
+    {
+        payload.insert(payload.end(), {u, v, w});
+    }
+
+    BinaryGraphHeader header{};
+    std::memcpy(header.magic, BINARY_GRAPH_MAGIC, sizeof(header.magic));
+    header.version = BINARY_GRAPH_VERSION;
+    header.number_of_nodes = static_cast<std::uint32_t>(n);
+    header.number_of_edges = edges.size();
+    header.adjacency_size = static_cast<std::uint64_t>(offsets[n]);
+    header.checksum = binary_graph_checksum(reinterpret_cast<const char*>(payload.data()),
+                                            payload.size() * sizeof(std::int32_t));
+
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open file " << file_path << std::endl;
+        return false;
     }
 
-    file.close();
-    return g;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(payload.data()),
+               static_cast<std::streamsize>(payload.size() * sizeof(std::int32_t)));
+    return file.good();
 }
 
 void BCPSolver::ArgParser::printUsage(const char* programName)
 {
     std::cerr << "Usage: " << programName << " <filename> <method> [options]\n"
+        << "       " << programName << " convert <input.col> <output.bcpg>\n"
         << "Arguments:\n"
-        << "  <filename>                      Path to the input file\n"
+        << "  <filename>                      Path to the input file (DIMACS .col or binary .bcpg)\n"
         << "  <method>                        Method for solving: '1G', '1L','2G', '2L', 'Xa(no-cache)', "
-        "'Xa(cache)', 'X'\n\n"
+        "'Xa(cache)', 'X', 'portfolio', '2G(lazy)'\n\n"
         << "Options:\n"
         << "  --solver <SATSolver>            SAT solver to use: 'cadical' (default), 'kissat'\n"
         << "  -t, --time_limit <int>          Set time limit\n"
@@ -148,10 +644,34 @@ void BCPSolver::ArgParser::printUsage(const char* programName)
         << "  --use-pairwise                  Enable pairwise encoding for all edges with d=1 while encoding\n"
         << "  -w , --width <vary|fixed>       Set width for encoding."
         "Note: This flag must be set for 'X', 'Xa' method but can be set for others. \n"
-        << "  -i, --incremental               Enable incremental mode. "
-        "Note: This flag requires '-v' to be set as well and does not support Kissat.\n"
+        << "  -i, --incremental               Enable incremental mode: probe every span on one formula through "
+        "assumptions. Note: This flag requires '-v' to be set as well; Kissat re-solves from scratch.\n"
         << "  -v  --variable-for-incremental  Variables used in incremental: 'x, 'y', 'both'. You must specify this when"
         " using incremental mode, but it will be ignored otherwise.\n"
+        << "  -s, --search <strategy>         Span search for optimal solving: 'linear' (default), 'ascending', "
+        "'binary', 'galloping', 'adaptive'. With a time limit the remaining time is split across the probes.\n"
+        << "  --ub-threads <int>              Threads running randomized DSatur/greedy starts for the upper bound "
+        "(default 1)\n"
+        << "  --ub-time <seconds>             Keep restarting the upper bound heuristics for this long (default 0)\n"
+        << "  --tabu-time <seconds>           Lower the upper bound with tabu search for this long (default 0)\n"
+        << "  --portfolio-threads <int>       Encodings run in parallel by the portfolio method: 1G, 2L, "
+        "Xa(cache), X, 2G, 1L in this order (default 4)\n"
+        << "  --cube-threads <int>            Split each span probe into cubes on the colors of the highest degree "
+        "vertices and solve them on this many threads (default 0, off)\n"
+        << "  --probe-threads <int>           With -i, probe this many spans below the best one at once on copies of "
+        "the encoding (default 0, off)\n"
+        << "                                  Values above 1 are rejected without -i\n"
+        << "  --share-clause-size <int>       Learned clauses up to this length are shared between the copies of "
+        "--cube-threads and --probe-threads (default 8, 0 disables, at most "
+        << SATSolver::MAX_SHARED_CLAUSE_SIZE << ")\n"
+        << "  --cegar                         Leave out the distance clauses of light edges outside the lower-bound "
+        "clique until a model violates them\n"
+        << "  --component-threads <int>       Solve every connected component on its own, on this many threads, "
+        "and report the largest span (default 0, off)\n"
+        << "  --kernelize                     Remove the vertices whose neighbors block fewer colors than the "
+        "span before encoding and color them greedily afterwards\n"
+        << "  --no-phase-seeding              Start the SAT solves from default phases instead of the best known "
+        "coloring\n"
         << "  -h, --help                      Show this help message\n";
 }
 
@@ -275,6 +795,197 @@ BCPSolver::ProgramConfig BCPSolver::ArgParser::parse(int argc, char* argv[])
             else
                 throw std::invalid_argument("Missing value for variable for incremental");
         }
+        else if (arg == "-s" || arg == "--search")
+        {
+            if (i + 1 < argc)
+            {
+                if (std::string strategy = argv[++i]; strategy == "linear")
+                {
+                    config.solver_options.search_strategy = LinearDescending;
+                }
+                else if (strategy == "ascending")
+                {
+                    config.solver_options.search_strategy = Ascending;
+                }
+                else if (strategy == "binary")
+                {
+                    config.solver_options.search_strategy = BinarySearch;
+                }
+                else if (strategy == "galloping")
+                {
+                    config.solver_options.search_strategy = Galloping;
+                }
+                else if (strategy == "adaptive")
+                {
+                    config.solver_options.search_strategy = Adaptive;
+                }
+                else
+                {
+                    throw std::invalid_argument(
+                        "Invalid search strategy: " + strategy +
+                        ". Expected 'linear', 'ascending', 'binary', 'galloping' or 'adaptive'.");
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for search strategy");
+        }
+        else if (arg == "--ub-threads")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.upper_bound_threads = std::stoi(argv[++i]);
+                    if (config.solver_options.upper_bound_threads < 1)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid number of upper bound threads: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for upper bound threads");
+        }
+        else if (arg == "--ub-time")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.upper_bound_time_limit = std::stod(argv[++i]);
+                    if (config.solver_options.upper_bound_time_limit < 0)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid upper bound time limit: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for upper bound time limit");
+        }
+        else if (arg == "--tabu-time")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.tabu_time_limit = std::stod(argv[++i]);
+                    if (config.solver_options.tabu_time_limit < 0)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid tabu search time limit: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for tabu search time limit");
+        }
+        else if (arg == "--portfolio-threads")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.portfolio_threads = std::stoi(argv[++i]);
+                    if (config.solver_options.portfolio_threads < 1)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid number of portfolio threads: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for portfolio threads");
+        }
+        else if (arg == "--cube-threads")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.cube_threads = std::stoi(argv[++i]);
+                    if (config.solver_options.cube_threads < 0)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid number of cube threads: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for cube threads");
+        }
+        else if (arg == "--probe-threads")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.probe_threads = std::stoi(argv[++i]);
+                    if (config.solver_options.probe_threads < 0)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid number of probe threads: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for probe threads");
+        }
+        else if (arg == "--share-clause-size")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.shared_clause_size = std::stoi(argv[++i]);
+                    if (config.solver_options.shared_clause_size < 0 ||
+                        config.solver_options.shared_clause_size > SATSolver::MAX_SHARED_CLAUSE_SIZE)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid shared clause size: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for shared clause size");
+        }
+        else if (arg == "--component-threads")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    config.solver_options.component_threads = std::stoi(argv[++i]);
+                    if (config.solver_options.component_threads < 0)
+                        throw std::exception();
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("Invalid number of component threads: " + std::string(argv[i]));
+                }
+            }
+            else
+                throw std::invalid_argument("Missing value for component threads");
+        }
+        else if (arg == "--kernelize")
+        {
+            config.solver_options.kernelize = true;
+        }
+        else if (arg == "--cegar")
+        {
+            config.solver_options.cegar = true;
+        }
+        else if (arg == "--no-phase-seeding")
+        {
+            config.solver_options.phase_seeding = false;
+        }
         else if (arg[0] == '-')
         {
             throw std::invalid_argument("Unknown flag: " + arg);
@@ -317,11 +1028,19 @@ BCPSolver::ProgramConfig BCPSolver::ArgParser::parse(int argc, char* argv[])
                 {
                     config.solving_method = StaircaseWithoutAuxiliaryVars;
                 }
+                else if (arg == "portfolio")
+                {
+                    config.solving_method = Portfolio;
+                }
+                else if (arg == "2G(lazy)")
+                {
+                    config.solving_method = TwoVariablesGreaterLazy;
+                }
                 else
                 {
                     throw std::invalid_argument(
                         "Invalid method: " + arg +
-                        ". Expected '1G', '1L','2G', '2L', 'Xa(no-cache)','Xa(cache)', 'X'.");
+                        ". Expected '1G', '1L','2G', '2L', 'Xa(no-cache)','Xa(cache)', 'X', 'portfolio', '2G(lazy)'.");
                 }
                 methodFound = true;
             }
@@ -336,6 +1055,8 @@ BCPSolver::ProgramConfig BCPSolver::ArgParser::parse(int argc, char* argv[])
         throw std::runtime_error("Missing compulsory argument: <filename>");
     if (!methodFound)
         throw std::runtime_error("Missing compulsory argument: <method>");
+    if (config.solver_options.probe_threads > 1 && !config.incremental_mode)
+        throw std::invalid_argument("--probe-threads only applies to the incremental search (-i)");
 
     return config;
 }
@@ -6,6 +6,7 @@
 #define BCP_BMCP_UTILITY_H
 
 #include <limits>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -29,7 +30,19 @@ namespace BCPSolver
         OneVariableLess,
         StaircaseWithAuxiliaryVarsNoCache,
         StaircaseWithAuxiliaryVarsWithCache,
-        StaircaseWithoutAuxiliaryVars
+        StaircaseWithoutAuxiliaryVars,
+        Portfolio,
+        TwoVariablesGreaterLazy
+    };
+
+    // Order in which the optimal solving loop probes spans between the bounds
+    enum SearchStrategy
+    {
+        LinearDescending,
+        Ascending,
+        BinarySearch,
+        Galloping,
+        Adaptive
     };
 
     static constexpr double NO_TIME_LIMIT = std::numeric_limits<double>::lowest();
@@ -38,18 +51,39 @@ namespace BCPSolver
     {
     private:
         std::vector<std::tuple<int, int, int>> edges_list{};
-        std::vector<std::vector<int>> matrix{};
+
+        // Compressed sparse row adjacency: the neighbors of node u are neighbors[offsets[u] .. offsets[u + 1]),
+        // sorted by id, and weights[k] is the weight of the edge to neighbors[k].
+        std::vector<int> offsets{};
+        std::vector<int> neighbors{};
+        std::vector<int> weights{};
         int n{};
 
+        // Invariants computed once the adjacency is known
+        std::vector<int> weighted_degrees{};
+        std::vector<int> max_incident_weights{};
+        std::vector<int> degree_order{};
+        int max_weight{};
+
+        void compute_invariants();
+
     public:
-        explicit Graph(const int n)
-            : edges_list(std::vector<std::tuple<int, int, int>>()), matrix(std::vector(n, std::vector<int>(n))),
-              n(n)
+        explicit Graph(const int n) : offsets(n + 1, 0), n(n)
         {
         }
 
         void add_edge(int i, int j, int w);
 
+        void reserve_edges(int m);
+
+        // Builds the adjacency and the cached invariants from the edges added so far. Must be called once all edges
+        // are added. A repeated edge keeps its largest weight, which is the constraint the encoders enforce for it.
+        void build_adjacency();
+
+        // Adopts a ready-made adjacency in the layout described above, e.g. one loaded from a binary graph file.
+        void assign_adjacency(std::vector<int> row_offsets, std::vector<int> row_neighbors,
+                              std::vector<int> row_weights);
+
         [[nodiscard]] const std::vector<std::tuple<int, int, int>>& get_edges() const;
 
         [[nodiscard]] int get_weight(int i, int j) const;
@@ -62,22 +96,68 @@ namespace BCPSolver
 
         [[nodiscard]] int get_degree(int node) const;
 
-        [[nodiscard]] std::vector<int> get_neighbors(const int node) const
+        [[nodiscard]] int get_weighted_degree(int node) const;
+
+        [[nodiscard]] int get_max_incident_weight(int node) const;
+
+        [[nodiscard]] int get_max_weight() const;
+
+        // Vertices by non-increasing degree, ties broken by id.
+        [[nodiscard]] const std::vector<int>& get_degree_order() const;
+
+        [[nodiscard]] std::span<const int> get_neighbors(const int node) const
+        {
+            return {neighbors.data() + offsets[node], neighbors.data() + offsets[node + 1]};
+        }
+
+        // Aligned with get_neighbors(node).
+        [[nodiscard]] std::span<const int> get_neighbor_weights(const int node) const
         {
-            std::vector<int> neighbors;
-            for (int j = 0; j < n; j++)
-            {
-                if (matrix[node][j] != 0)
-                {
-                    neighbors.push_back(j);
-                }
-            }
-            return neighbors;
+            return {weights.data() + offsets[node], weights.data() + offsets[node + 1]};
         }
     };
 
+    // Reads a DIMACS .col file, or a binary graph written by write_binary_graph(); the format is detected from the
+    // file contents.
     Graph* read_bcp_graph(const std::string& file_path);
 
+    bool write_binary_graph(const Graph& graph, const std::string& file_path);
+
+    // Settings of the solving pipeline around the encoding
+    struct SolverOptions
+    {
+        // Worker threads of the multi-start upper-bound stage
+        int upper_bound_threads;
+        // Seconds the upper-bound stage keeps restarting for; with 0 every thread runs a single start
+        double upper_bound_time_limit;
+        // Seconds of tabu search spent lowering the heuristic upper bound; 0 disables it
+        double tabu_time_limit;
+        SearchStrategy search_strategy;
+        // Start every solve from the best known coloring through the decision phases
+        bool phase_seeding;
+        // Encodings the portfolio method runs side by side
+        int portfolio_threads;
+        // Threads solving the cubes of each span probe with CaDiCaL; 0 solves every probe as a whole
+        int cube_threads;
+        // Copies of the incremental encoding probing different spans at once; 0 or 1 probes one span at a time
+        int probe_threads;
+        // Longest learned clause passed between the copies solving cubes or probing spans; 0 disables sharing
+        int shared_clause_size;
+        // Encode the heavy edges and those of the lower-bound clique first, and the others once a model violates them
+        bool cegar;
+        // Threads solving the connected components of the graph one by one; 0 solves the graph as a whole
+        int component_threads;
+        // Leave out the vertices that can always be colored after their neighbors and color them greedily
+        bool kernelize;
+
+        SolverOptions() : upper_bound_threads(1), upper_bound_time_limit(0), tabu_time_limit(0),
+                          search_strategy(LinearDescending), phase_seeding(true), portfolio_threads(4),
+                          cube_threads(0), probe_threads(0), shared_clause_size(8), cegar(false),
+                          component_threads(0), kernelize(false)
+        {
+        }
+    };
+
     struct ProgramConfig
     {
         std::string filename;
@@ -91,6 +171,7 @@ namespace BCPSolver
         std::string width;
         SATSolver::SOLVER solver;
         SolvingMethod solving_method;
+        SolverOptions solver_options;
         // Constructor with defaults
         ProgramConfig()
             : time_limit(NO_TIME_LIMIT), upper_bound(-1), find_optimal(true), incremental_mode(false),
@@ -0,0 +1,46 @@
+#ifndef BCP_VARIABLE_TABLE_H
+#define BCP_VARIABLE_TABLE_H
+
+namespace BCPSolver
+{
+    // Dense (node, color) -> SAT variable layout. Variables of one table are allocated as a single block, so a
+    // lookup is pure arithmetic on the base offset. A stride greater than one interleaves several tables that were
+    // allocated together (e.g. x and y of the two-variable methods).
+    class VariableTable
+    {
+    private:
+        int base{};
+        int stride{1};
+        int span{};
+
+    public:
+        VariableTable() = default;
+
+        void assign(const int first_variable, const int span, const int stride = 1)
+        {
+            this->base = first_variable;
+            this->span = span;
+            this->stride = stride;
+        }
+
+        void clear()
+        {
+            base = 0;
+            span = 0;
+        }
+
+        [[nodiscard]] int get_number_of_colors() const { return span; }
+
+        // Colors are 1-based. Colors outside [1, span] have no variable and yield 0.
+        [[nodiscard]] int operator()(const int node, const int color) const
+        {
+            if (color < 1 || color > span)
+            {
+                return 0;
+            }
+            return base + stride * (node * span + color - 1);
+        }
+    };
+} // namespace BCPSolver
+
+#endif //BCP_VARIABLE_TABLE_H
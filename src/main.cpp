@@ -5,6 +5,24 @@
 
 int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string(argv[1]) == "convert")
+    {
+        if (argc != 4)
+        {
+            BCPSolver::ArgParser::printUsage(argv[0]);
+            return 1;
+        }
+
+        const auto* g = BCPSolver::read_bcp_graph(argv[2]);
+        if (g == nullptr)
+        {
+            return 1;
+        }
+        const bool written = BCPSolver::write_binary_graph(*g, argv[3]);
+        delete g;
+        return written ? 0 : 1;
+    }
+
     try
     {
         const BCPSolver::ProgramConfig config = BCPSolver::ArgParser::parse(argc, argv);
@@ -14,9 +32,14 @@ int main(int argc, char* argv[])
         {
             exit(1);
         }
+        // The time limit starts before the bound stages that run while the solver is created
+        auto& deadline = SATSolver::Deadline::global();
+        deadline.arm(config.time_limit);
         auto* s = BCPSolver::BCPSolver::create_solver(config.solving_method, g, config.solver, config.upper_bound,
-                                                      config.use_symmetry_breaking, config.use_pairwise, config.width);
+                                                      config.use_symmetry_breaking, config.use_pairwise, config.width,
+                                                      config.solver_options);
         s->solve(config.time_limit, config.find_optimal, config.incremental_mode, config.variable_for_incremental);
+        deadline.disarm();
         for (auto stats = s->get_statistics(); const auto& [fst, snd] : stats)
         {
             std::cout << fst << ": " << snd << '\n';
@@ -4,132 +4,54 @@
 
 #include "Cadical.h"
 
-#include <condition_variable>
-#include <fstream>
-#include <iostream>
-
-#ifdef _WIN32
-#include <io.h>
-#define DUP _dup
-#define DUP2 _dup2
-#define FILENO _fileno
-#define UNLINK _unlink
-#else
-#include <unistd.h>
-#define DUP dup
-#define DUP2 dup2
-#define FILENO fileno
-#define UNLINK unlink
-#endif
-
-// Static mutex to protect stdout redirection (process-global resource)
-static std::mutex stdout_capture_mutex;
-
-void SATSolver::Cadical::capture_and_accumulate_stats()
-{
-    std::lock_guard<std::mutex> lock(stdout_capture_mutex);
-
-    const char* temp_filename = "cadical_stats_capture.tmp";
-
-    // 1. Flush current stdout to ensure clean state
-    fflush(stdout);
-
-    // 2. Save the current stdout file descriptor
-    int original_stdout_fd = DUP(FILENO(stdout));
-
-    // 3. Redirect stdout to our temp file
-    if (freopen(temp_filename, "w", stdout) == nullptr)
-    {
-        // Fallback: If redirection fails, restore and exit
-        // (Original fd is still open, just close duplicate)
-#ifdef _WIN32
-        _close(original_stdout_fd);
-#else
-        close(original_stdout_fd);
-#endif
-        return;
-    }
-
-    // 4. Call CaDiCaL statistics (writes to the temp file now)
-    solver->statistics();
-
-    // 5. Flush and Restore stdout
-    fflush(stdout);
-    DUP2(original_stdout_fd, FILENO(stdout)); // Replace stdout with original
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
 
-    // Close the backup fd
-#ifdef _WIN32
-    _close(original_stdout_fd);
-#else
-    close(original_stdout_fd);
-#endif
+SATSolver::Cadical::Cadical()
+{
+    solver->connect_learner(&learned_counter);
+}
 
-    // 6. Read the temp file and parse
-    std::ifstream infile(temp_filename);
-    std::string line;
-    while (std::getline(infile, line))
+std::unique_ptr<SATSolver::SatSolver> SATSolver::Cadical::clone()
+{
+    if (propagator != nullptr)
     {
-        // Skip lines that don't look like stats
-        if (line.empty() || line[0] != 'c') continue;
-
-        std::stringstream ss(line);
-        std::string token;
-        std::vector<std::string> tokens;
-        while (ss >> token)
-        {
-            tokens.push_back(token);
-        }
-
-        // Check format: "c [key]: [value] ..."
-        // Need at least "c", "key:", "value"
-        if (tokens.size() < 3) continue;
+        throw std::logic_error("A copy would lose the constraints of the external propagator");
+    }
 
-        // Iterate to find the key ending in ':'
-        for (size_t i = 1; i < tokens.size() - 1; ++i)
+    // Only irredundant clauses carry over; the copy learns on its own
+    auto copy = std::make_unique<Cadical>();
+    solver->copy(*copy->solver);
+    for (const auto phase : phases)
+    {
+        if (phase != 0)
         {
-            if (tokens[i].back() == ':')
-            {
-                std::string key = tokens[i];
-                key.pop_back(); // Remove ':'
-
-                try
-                {
-                    // The next token is the value
-                    double value = std::stod(tokens[i + 1]);
-
-                    // Sum the value into our map
-                    stats_accum[key] += value;
-                }
-                catch (...)
-                {
-                    // Ignore non-numeric values
-                }
-                break; // Found the stat for this line, move to next line
-            }
+            copy->set_phase(phase);
         }
     }
-    infile.close();
-
-    // 7. Delete the temp file
-    UNLINK(temp_filename);
+    copy->number_of_variables = number_of_variables;
+    copy->number_of_clauses = number_of_clauses;
+    return copy;
 }
 
 void SATSolver::Cadical::add_clause(const std::vector<int>& clause)
 {
-    number_of_clauses++;
+    count_clause();
     solver->clause(clause);
 }
 
 void SATSolver::Cadical::add_clause(const int l)
 {
-    number_of_clauses++;
+    count_clause();
     solver->clause(l);
     // std::cout << '[' << l << ']' << '\n';
 }
 
 void SATSolver::Cadical::add_clause(const int l1, const int l2)
 {
-    number_of_clauses++;
+    count_clause();
     if (l1 < l2)
     {
         solver->clause(l1, l2);
@@ -144,7 +66,7 @@ void SATSolver::Cadical::add_clause(const int l1, const int l2)
 
 void SATSolver::Cadical::add_clause(const int l1, const int l2, const int l3)
 {
-    number_of_clauses++;
+    count_clause();
     const int x = std::min({l1, l2, l3});
     const int z = std::max({l1, l2, l3});
     const int y = l1 + l2 + l3 - x - z;
@@ -154,19 +76,21 @@ void SATSolver::Cadical::add_clause(const int l1, const int l2, const int l3)
 
 void SATSolver::Cadical::add_clause(const int l1, const int l2, const int l3, const int l4)
 {
-    number_of_clauses++;
+    count_clause();
     solver->clause(l1, l2, l3, l4);
     // std::cout << '[' << l1 << ", " << l2 << ", " << l3 << ", " << l4 << ']' << '\n';
 }
 
 int SATSolver::Cadical::solve(const std::vector<int>* assumptions, const double time_limit)
 {
-    if (time_limit != NO_TIME_LIMIT && time_limit < 0.0)
+    if ((time_limit != NO_TIME_LIMIT && time_limit < 0.0) || Deadline::global().expired())
     {
         status = CaDiCaL::Status::UNKNOWN;
         return status;
     }
 
+    cube_model.clear();
+    import_shared_clauses();
     if (assumptions != nullptr)
     {
         for (const auto assumption : *assumptions)
@@ -176,70 +100,242 @@ int SATSolver::Cadical::solve(const std::vector<int>* assumptions, const double
     }
 
     const auto start_time = std::chrono::high_resolution_clock::now();
+    const long long learned_before = learned_counter.learned;
+    const long long learned_literals_before = learned_counter.learned_literals;
+    const long long exported_before = learned_counter.exported;
 
-    if (time_limit == NO_TIME_LIMIT)
+    // The watchdog stops the search at the end of the slice or at the global deadline, whichever comes first
+    terminator.force_terminate.store(false, std::memory_order_relaxed);
+    solver->connect_terminator(&terminator);
     {
+        const auto watch = Deadline::global().watch(time_limit, [this]
+        {
+            terminator.force_terminate.store(true, std::memory_order_relaxed);
+        });
         status = solver->solve();
-        // Capture immediately after solving
-        capture_and_accumulate_stats();
     }
-    else
+    solver->disconnect_terminator();
+
+    const double time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+    time_accum += time;
+
+    SolveRecord record;
+    record.result = status;
+    record.time = time;
+    record.active_variables = solver->active();
+    record.irredundant_clauses = solver->irredundant();
+    record.redundant_clauses = solver->redundant();
+    record.learned = learned_counter.learned - learned_before;
+    record.learned_literals = learned_counter.learned_literals - learned_literals_before;
+    record.exported = learned_counter.exported - exported_before;
+    record.imported = imported;
+    record.useful = useful;
+    imported = 0;
+    useful = 0;
+    solve_records.push_back(record);
+
+    return status;
+}
+
+int SATSolver::Cadical::solve_cubes(const std::vector<std::vector<int>>& cubes, const int threads,
+                                    const std::vector<int>* assumptions, const double time_limit)
+{
+    const int workers = std::min(threads, static_cast<int>(cubes.size()));
+    if (workers <= 1)
     {
-        AtomicTerminator terminator;
-        solver->connect_terminator(&terminator);
+        return SatSolver::solve_cubes(cubes, threads, assumptions, time_limit);
+    }
 
-        std::mutex mtx;
-        std::condition_variable cv;
-        bool finished = false;
+    if ((time_limit != NO_TIME_LIMIT && time_limit < 0.0) || Deadline::global().expired())
+    {
+        status = CaDiCaL::Status::UNKNOWN;
+        return status;
+    }
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    cube_model.clear();
+
+    // Each worker searches its own copy of the formula, warm-started from the same phases
+    std::vector<std::unique_ptr<SatSolver>> copies;
+    const auto exchange = shared_clause_size > 0
+                              ? std::make_unique<ClauseExchange>(shared_clause_size, number_of_variables)
+                              : nullptr;
+    for (int k = 0; k < workers; k++)
+    {
+        copies.push_back(clone());
+        copies.back()->share_clauses(exchange.get(), k);
+    }
 
-        std::thread timer_thread([&]()
+    // Workers take the next unsolved cube until one is satisfiable or one cannot be decided
+    std::atomic<size_t> next_cube{0};
+    std::atomic<int> winner{-1};
+    std::atomic<bool> finished{false};
+    std::atomic<bool> unresolved{false};
+    const auto& parent_stop = terminator.should_stop;
+    std::vector<std::thread> pool;
+    for (int k = 0; k < workers; k++)
+    {
+        pool.emplace_back([&, k]
         {
-            std::unique_lock<std::mutex> lk(mtx);
-            if (!cv.wait_for(lk, std::chrono::duration<double>(time_limit), [&] { return finished; }))
+            auto& copy = *copies[k];
+            copy.set_interrupt([&]
             {
-                terminator.force_terminate.store(true, std::memory_order_relaxed);
-            }
-        });
+                return finished.load(std::memory_order_relaxed) || (parent_stop && parent_stop());
+            });
 
-        status = solver->solve();
+            for (size_t i = next_cube++; i < cubes.size() && !finished.load(std::memory_order_relaxed);
+                 i = next_cube++)
+            {
+                std::vector<int> cube_assumptions = assumptions != nullptr ? *assumptions : std::vector<int>{};
+                cube_assumptions.insert(cube_assumptions.end(), cubes[i].begin(), cubes[i].end());
+
+                double slice = NO_TIME_LIMIT;
+                if (time_limit != NO_TIME_LIMIT)
+                {
+                    slice = time_limit - std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - start_time).count();
+                }
 
-        // Capture immediately after solving
-        capture_and_accumulate_stats();
+                const int result = copy.solve(&cube_assumptions, slice);
+                if (result == CaDiCaL::Status::SATISFIABLE)
+                {
+                    int none = -1;
+                    winner.compare_exchange_strong(none, k);
+                    finished = true;
+                }
+                else if (result != CaDiCaL::Status::UNSATISFIABLE)
+                {
+                    unresolved = true;
+                    finished = true;
+                }
+            }
+        });
+    }
+    for (auto& worker : pool)
+    {
+        worker.join();
+    }
 
+    if (winner >= 0)
+    {
+        status = CaDiCaL::Status::SATISFIABLE;
+        const auto& model = *copies[winner];
+        cube_model.assign(solver->vars() + 1, 0);
+        for (int v = 1; v < static_cast<int>(cube_model.size()); v++)
         {
-            std::lock_guard<std::mutex> lk(mtx);
-            finished = true;
+            cube_model[v] = model.value(v);
         }
-        cv.notify_one();
+    }
+    else
+    {
+        status = unresolved ? CaDiCaL::Status::UNKNOWN : CaDiCaL::Status::UNSATISFIABLE;
+    }
 
-        if (timer_thread.joinable())
+    const double time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+    time_accum += time;
+
+    SolveRecord record;
+    record.result = status;
+    record.time = time;
+    record.active_variables = solver->active();
+    record.irredundant_clauses = solver->irredundant();
+    record.redundant_clauses = solver->redundant();
+    for (const auto& copy : copies)
+    {
+        for (const auto& cube_record : copy->get_solve_records())
         {
-            timer_thread.join();
+            record.learned += cube_record.learned;
+            record.learned_literals += cube_record.learned_literals;
+            record.exported += cube_record.exported;
+            record.imported += cube_record.imported;
+            record.useful += cube_record.useful;
         }
+    }
+    solve_records.push_back(record);
 
-        solver->disconnect_terminator();
+    return status;
+}
+
+int SATSolver::Cadical::value(const int literal) const
+{
+    if (!cube_model.empty())
+    {
+        return (cube_model[std::abs(literal)] > 0) == (literal > 0) ? literal : -literal;
     }
+    return solver->val(literal);
+}
 
-    time_accum += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+void SATSolver::Cadical::set_phase(const int literal)
+{
+    solver->phase(literal);
+    const auto variable = static_cast<size_t>(std::abs(literal));
+    if (variable >= phases.size())
+    {
+        phases.resize(variable + 1, 0);
+    }
+    phases[variable] = literal;
+}
 
-    return status;
+void SATSolver::Cadical::set_interrupt(std::function<bool()> should_stop)
+{
+    terminator.should_stop = std::move(should_stop);
 }
 
-void SATSolver::Cadical::reset()
+void SATSolver::Cadical::share_clauses(ClauseExchange* exchange, const int id)
 {
-    number_of_clauses = 0;
-    number_of_variables = 0;
-    solver = std::make_unique<CaDiCaL::Solver>();
+    learned_counter.exchange = exchange;
+    learned_counter.id = id;
+    exchange_cursor = 0;
 }
 
-std::unordered_map<std::string, double> SATSolver::Cadical::get_statistics() const
+void SATSolver::Cadical::connect_propagator(CaDiCaL::ExternalPropagator* external_propagator,
+                                            const std::vector<int>& observed)
 {
-    auto final_stats = stats_accum;
+    propagator = external_propagator;
+    solver->connect_external_propagator(propagator);
+    for (const auto variable : observed)
+    {
+        solver->add_observed_var(variable);
+    }
+}
 
-    // Add/Overwrite with manual SATSolver base metrics
-    final_stats["total_solving_time"] = time_accum;
-    final_stats["clauses"] = number_of_clauses;
-    final_stats["variables"] = number_of_variables;
+void SATSolver::Cadical::disconnect_propagator()
+{
+    if (propagator != nullptr)
+    {
+        solver->disconnect_external_propagator();
+        propagator = nullptr;
+    }
+}
 
-    return final_stats;
+void SATSolver::Cadical::import_shared_clauses()
+{
+    if (learned_counter.exchange == nullptr)
+    {
+        return;
+    }
+
+    // Solves are the safe points: between them clauses can be added to CaDiCaL directly
+    learned_counter.exchange->drain(learned_counter.id, exchange_cursor, [this](const std::vector<int>& clause)
+    {
+        imported++;
+        if (std::any_of(clause.begin(), clause.end(), [this](const int lit) { return solver->fixed(lit) > 0; }))
+        {
+            return;
+        }
+        useful++;
+        solver->clause(clause);
+    });
+}
+
+void SATSolver::Cadical::reset()
+{
+    number_of_clauses = 0;
+    number_of_variables = 0;
+    solver = std::make_unique<CaDiCaL::Solver>();
+    solver->connect_learner(&learned_counter);
+    phases.clear();
+    cube_model.clear();
+    learned_counter.exchange = nullptr;
+    propagator = nullptr;
 }
@@ -5,6 +5,7 @@
 #ifndef BCP_CADICAL_H
 #define BCP_CADICAL_H
 #include <atomic>
+#include <memory>
 
 #include "cadical.hpp"
 #include "SatSolver.h"
@@ -25,22 +26,74 @@ namespace SATSolver
         {
         public:
             std::atomic<bool> force_terminate{false};
+            std::function<bool()> should_stop;
 
             bool terminate() override
             {
-                return force_terminate.load(std::memory_order_relaxed);
+                return force_terminate.load(std::memory_order_relaxed) || (should_stop && should_stop());
             }
         };
 
-        std::unordered_map<std::string, double> stats_accum;
+        AtomicTerminator terminator;
 
-        void capture_and_accumulate_stats();
+        // Counts learned clauses. Their literals are only asked for when the clause is short enough to be shared.
+        class LearnedCounter final : public CaDiCaL::Learner
+        {
+        public:
+            long long learned{};
+            long long learned_literals{};
+            long long exported{};
+
+            ClauseExchange* exchange{};
+            int id{};
+            std::vector<int> clause;
+
+            bool learning(const int size) override
+            {
+                learned++;
+                learned_literals += size;
+                return exchange != nullptr && size <= exchange->get_max_size();
+            }
+
+            void learn(const int lit) override
+            {
+                if (lit != 0)
+                {
+                    clause.push_back(lit);
+                    return;
+                }
+                if (exchange->offer(id, clause))
+                {
+                    exported++;
+                }
+                clause.clear();
+            }
+        };
+
+        LearnedCounter learned_counter;
+
+        // Position in the exchange up to which clauses were imported
+        std::uint64_t exchange_cursor{};
+        long long imported{};
+        long long useful{};
+
+        void import_shared_clauses();
+
+        // Propagator connected since the last reset, if any
+        CaDiCaL::ExternalPropagator* propagator{};
+
+        // Phases set since the last reset, indexed by variable, replayed on the copies solving cubes
+        std::vector<int> phases;
+        // Model of the cube that answered the last solve_cubes call, indexed by variable
+        std::vector<int> cube_model;
 
     public:
-        Cadical() = default;
+        Cadical();
 
         ~Cadical() override = default;
 
+        [[nodiscard]] std::unique_ptr<SatSolver> clone() override;
+
         void add_clause(const std::vector<int>& clause) override;
 
         void add_clause(int l) override;
@@ -53,9 +106,23 @@ namespace SATSolver
 
         int solve(const std::vector<int>* assumptions, double time_limit) override;
 
-        void reset() override;
+        int solve_cubes(const std::vector<std::vector<int>>& cubes, int threads, const std::vector<int>* assumptions,
+                        double time_limit) override;
+
+        [[nodiscard]] int value(int literal) const override;
 
-        std::unordered_map<std::string, double> get_statistics() const override;
+        void set_phase(int literal) override;
+
+        void set_interrupt(std::function<bool()> should_stop) override;
+
+        void share_clauses(ClauseExchange* exchange, int id) override;
+
+        // Lets the propagator add clauses over the observed variables during the following solves, until reset()
+        void connect_propagator(CaDiCaL::ExternalPropagator* external_propagator, const std::vector<int>& observed);
+
+        void disconnect_propagator();
+
+        void reset() override;
     };
 } // SATSolver
 
@@ -0,0 +1,42 @@
+#include "ClauseExchange.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+SATSolver::ClauseExchange::ClauseExchange(const int max_size, const int shared_variables)
+    : max_size(std::min(max_size, MAX_SHARED_CLAUSE_SIZE)), shared_variables(shared_variables)
+{
+}
+
+bool SATSolver::ClauseExchange::offer(const int producer, const std::vector<int>& clause)
+{
+    if (clause.empty() || static_cast<int>(clause.size()) > max_size ||
+        std::any_of(clause.begin(), clause.end(), [this](const int lit) { return std::abs(lit) > shared_variables; }))
+    {
+        return false;
+    }
+
+    const std::uint64_t ticket = head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots[ticket % CAPACITY];
+
+    // Claims the slot unless a producer a whole lap ahead, or still writing, holds it
+    std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    do
+    {
+        if (sequence % 2 == 1 || sequence > 2 * ticket)
+        {
+            return false;
+        }
+    }
+    while (!slot.sequence.compare_exchange_weak(sequence, 2 * ticket + 1, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.producer.store(producer, std::memory_order_relaxed);
+    slot.size.store(static_cast<int>(clause.size()), std::memory_order_relaxed);
+    for (std::size_t i = 0; i < clause.size(); i++)
+    {
+        slot.literals[i].store(clause[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(2 * ticket + 2, std::memory_order_release);
+    return true;
+}
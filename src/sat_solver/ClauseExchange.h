@@ -0,0 +1,84 @@
+#ifndef BCP_CLAUSE_EXCHANGE_H
+#define BCP_CLAUSE_EXCHANGE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SATSolver
+{
+    // Longest clause the exchange can carry
+    static constexpr int MAX_SHARED_CLAUSE_SIZE = 32;
+
+    // Short learned clauses passed between solvers working on copies of one formula. Producers publish into a
+    // lock-free ring buffer of fixed slots; every consumer keeps its own cursor. Delivery is best effort: clauses
+    // overwritten before a consumer reads them, or still being written while it reads, are skipped.
+    class ClauseExchange
+    {
+    private:
+        static constexpr std::uint64_t CAPACITY = 4096;
+
+        // The sequence is 2t + 1 while ticket t is written into the slot and 2t + 2 once it is complete
+        struct Slot
+        {
+            std::atomic<std::uint64_t> sequence{0};
+            std::atomic<int> producer{};
+            std::atomic<int> size{};
+            std::array<std::atomic<int>, MAX_SHARED_CLAUSE_SIZE> literals{};
+        };
+
+        std::unique_ptr<Slot[]> slots{std::make_unique<Slot[]>(CAPACITY)};
+        std::atomic<std::uint64_t> head{0};
+
+        int max_size;
+        int shared_variables;
+
+    public:
+        // Clauses longer than max_size or over variables above shared_variables are not exchanged
+        ClauseExchange(int max_size, int shared_variables);
+
+        [[nodiscard]] int get_max_size() const { return max_size; }
+
+        // Publishes a clause; false when the filter rejects it or a lapping producer holds its slot
+        bool offer(int producer, const std::vector<int>& clause);
+
+        // Calls on_clause with every clause of the other producers published since the cursor, then advances it
+        template <typename Callback>
+        void drain(const int consumer, std::uint64_t& cursor, Callback&& on_clause) const
+        {
+            const std::uint64_t end = head.load(std::memory_order_acquire);
+            if (end - cursor > CAPACITY)
+            {
+                cursor = end - CAPACITY;
+            }
+
+            std::vector<int> clause;
+            for (; cursor < end; cursor++)
+            {
+                const Slot& slot = slots[cursor % CAPACITY];
+                const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != 2 * cursor + 2 || slot.producer.load(std::memory_order_relaxed) == consumer)
+                {
+                    continue;
+                }
+
+                clause.resize(slot.size.load(std::memory_order_relaxed));
+                for (std::size_t i = 0; i < clause.size(); i++)
+                {
+                    clause[i] = slot.literals[i].load(std::memory_order_relaxed);
+                }
+
+                // A producer that took the slot meanwhile may have torn the clause
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == sequence)
+                {
+                    on_clause(clause);
+                }
+            }
+        }
+    };
+} // SATSolver
+
+#endif //BCP_CLAUSE_EXCHANGE_H
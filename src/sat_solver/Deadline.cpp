@@ -0,0 +1,141 @@
+#include "Deadline.h"
+
+#include <algorithm>
+
+#include "SatSolver.h"
+
+SATSolver::Deadline::~Deadline()
+{
+    {
+        std::lock_guard lock(mutex);
+        shutting_down = true;
+    }
+    wake.notify_all();
+    if (watchdog.joinable())
+    {
+        watchdog.join();
+    }
+}
+
+SATSolver::Deadline& SATSolver::Deadline::global()
+{
+    static Deadline instance;
+    return instance;
+}
+
+void SATSolver::Deadline::start_watchdog()
+{
+    if (!watchdog.joinable())
+    {
+        watchdog = std::thread(&Deadline::run, this);
+    }
+}
+
+void SATSolver::Deadline::run()
+{
+    std::unique_lock lock(mutex);
+    while (!shutting_down)
+    {
+        auto next = Clock::time_point::max();
+        if (deadline && !expired())
+        {
+            next = *deadline;
+        }
+        for (const auto& [id, watch] : watches)
+        {
+            if (!watch.fired)
+            {
+                next = std::min(next, watch.stop);
+            }
+        }
+
+        if (next == Clock::time_point::max())
+        {
+            wake.wait(lock);
+        }
+        else
+        {
+            wake.wait_until(lock, next);
+        }
+
+        const auto now = Clock::now();
+        if (deadline && now >= *deadline)
+        {
+            expired_flag.store(true, std::memory_order_relaxed);
+        }
+        for (auto& [id, watch] : watches)
+        {
+            if (!watch.fired && (expired() || now >= watch.stop))
+            {
+                watch.fired = true;
+                watch.on_stop();
+            }
+        }
+    }
+}
+
+void SATSolver::Deadline::arm(const double seconds)
+{
+    if (seconds == NO_TIME_LIMIT)
+    {
+        disarm();
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        expired_flag.store(seconds <= 0, std::memory_order_relaxed);
+        start_watchdog();
+    }
+    wake.notify_one();
+}
+
+void SATSolver::Deadline::disarm()
+{
+    {
+        std::lock_guard lock(mutex);
+        deadline.reset();
+        expired_flag.store(false, std::memory_order_relaxed);
+    }
+    wake.notify_one();
+}
+
+bool SATSolver::Deadline::armed() const
+{
+    std::lock_guard lock(mutex);
+    return deadline.has_value();
+}
+
+double SATSolver::Deadline::remaining() const
+{
+    std::lock_guard lock(mutex);
+    if (!deadline)
+    {
+        return NO_TIME_LIMIT;
+    }
+    return std::chrono::duration<double>(*deadline - Clock::now()).count();
+}
+
+SATSolver::Deadline::Guard SATSolver::Deadline::watch(const double slice, std::function<void()> on_stop)
+{
+    int id;
+    {
+        std::lock_guard lock(mutex);
+        const auto stop = slice == NO_TIME_LIMIT
+                              ? Clock::time_point::max()
+                              : Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(std::max(slice, 0.0)));
+        id = next_watch_id++;
+        watches.emplace(id, Watch{stop, std::move(on_stop), false});
+        start_watchdog();
+    }
+    wake.notify_one();
+    return {this, id};
+}
+
+void SATSolver::Deadline::unwatch(const int id)
+{
+    std::lock_guard lock(mutex);
+    watches.erase(id);
+}
@@ -0,0 +1,109 @@
+#ifndef BCP_DEADLINE_H
+#define BCP_DEADLINE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace SATSolver
+{
+    // Thrown by cooperative checks once the deadline has passed
+    class DeadlineExpired : public std::runtime_error
+    {
+    public:
+        DeadlineExpired() : std::runtime_error("Time limit reached") {}
+    };
+
+    // Process-wide wall-clock deadline. A single watchdog thread raises the expired flag and stops the registered
+    // solves, either at the deadline or at the end of their own time slice.
+    class Deadline
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Watch
+        {
+            Clock::time_point stop;
+            std::function<void()> on_stop;
+            bool fired;
+        };
+
+        mutable std::mutex mutex;
+        std::condition_variable wake;
+        std::thread watchdog;
+        bool shutting_down{false};
+
+        std::atomic<bool> expired_flag{false};
+        std::optional<Clock::time_point> deadline;
+
+        std::map<int, Watch> watches;
+        int next_watch_id{};
+
+        Deadline() = default;
+
+        void run();
+
+        void start_watchdog();
+
+        void unwatch(int id);
+
+    public:
+        // Keeps a watch registered while in scope
+        class Guard
+        {
+        private:
+            Deadline* owner;
+            int id;
+
+        public:
+            Guard(Deadline* owner, const int id) : owner(owner), id(id) {}
+
+            Guard(const Guard&) = delete;
+
+            Guard& operator=(const Guard&) = delete;
+
+            ~Guard() { owner->unwatch(id); }
+        };
+
+        Deadline(const Deadline&) = delete;
+
+        Deadline& operator=(const Deadline&) = delete;
+
+        ~Deadline();
+
+        static Deadline& global();
+
+        // Expires the given number of seconds from now; NO_TIME_LIMIT disarms
+        void arm(double seconds);
+
+        void disarm();
+
+        [[nodiscard]] bool armed() const;
+
+        [[nodiscard]] bool expired() const { return expired_flag.load(std::memory_order_relaxed); }
+
+        // Throws DeadlineExpired once the deadline has passed
+        void check() const
+        {
+            if (expired())
+            {
+                throw DeadlineExpired();
+            }
+        }
+
+        // Seconds left before the deadline, NO_TIME_LIMIT when disarmed
+        [[nodiscard]] double remaining() const;
+
+        // Calls on_stop from the watchdog once the slice (NO_TIME_LIMIT for none) or the deadline runs out. The
+        // callback runs at most once and never after the guard is gone.
+        [[nodiscard]] Guard watch(double slice, std::function<void()> on_stop);
+    };
+} // SATSolver
+
+#endif //BCP_DEADLINE_H
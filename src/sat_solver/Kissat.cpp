@@ -3,101 +3,187 @@
 //
 
 #include "Kissat.h"
-#include <cstdlib>
-
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <csignal>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
-#include <random>
+#include <sstream>
+#include <string_view>
 
-#include "cadical.hpp"
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
-namespace fs = std::filesystem;
+#include "cadical.hpp"
 
-std::string SATSolver::Kissat::get_random_filename()
+namespace
 {
-    static constexpr char alphanum[] =
-        "0123456789"
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz";
-    constexpr std::size_t len = 5;
-
-    thread_local std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution<std::size_t> dist(0, sizeof(alphanum) - 2);
-
-    std::string s;
-    s.reserve(len);
-    for (std::size_t i = 0; i < len; ++i)
+    // Buffers DIMACS text and hands it to the pipe in large writes. Stops quietly once the reader is gone.
+    class PipeWriter
     {
-        s += alphanum[dist(rng)];
-    }
-    return s;
-}
+    private:
+        static constexpr std::size_t BUFFER_SIZE = 1 << 20;
 
-std::string SATSolver::Kissat::write_cnf_to_file() const
-{
-    const std::string filename = "cnf/" + get_random_filename() + ".cnf";
+        int fd;
+        std::vector<char> buffer = std::vector<char>(BUFFER_SIZE);
+        // End of the buffered text
+        char* next{buffer.data()};
+        bool broken{};
 
-    if (fs::path folder = "cnf"; !fs::exists(folder))
-    {
-        if (!fs::create_directory(folder))
+        [[nodiscard]] std::size_t available() const
         {
-            throw std::runtime_error("Failed to create directory");
+            return static_cast<std::size_t>(buffer.data() + BUFFER_SIZE - next);
+        }
+
+    public:
+        explicit PipeWriter(const int fd) : fd(fd) {}
+
+        void put(const int value)
+        {
+            // An int takes at most 11 characters plus the separator
+            if (available() < 12)
+            {
+                flush();
+            }
+            next = std::to_chars(next, buffer.data() + BUFFER_SIZE, value).ptr;
+        }
+
+        // A literal followed by a space, or the closing "0\n" of a clause
+        void put_literal(const int lit)
+        {
+            if (available() < 12)
+            {
+                flush();
+            }
+            if (lit == 0)
+            {
+                *next++ = '0';
+                *next++ = '\n';
+                return;
+            }
+            next = std::to_chars(next, buffer.data() + BUFFER_SIZE, lit).ptr;
+            *next++ = ' ';
+        }
+
+        void put(const char c)
+        {
+            if (available() == 0)
+            {
+                flush();
+            }
+            *next++ = c;
+        }
+
+        void put(const std::string_view text)
+        {
+            for (const char c : text)
+            {
+                put(c);
+            }
         }
-    }
 
-    std::ofstream cnf_file(filename);
-    cnf_file << "p cnf " << number_of_variables << " " << number_of_clauses << "\n";
-    for (const auto& clause : clauses)
+        void flush()
+        {
+            const char* written = buffer.data();
+            while (!broken && written < next)
+            {
+                if (const ssize_t n = write(fd, written, next - written); n >= 0)
+                {
+                    written += n;
+                }
+                else if (errno != EINTR)
+                {
+                    broken = true;
+                }
+            }
+            next = buffer.data();
+        }
+    };
+
+    void make_pipe(int fds[2])
     {
-        for (const int lit : clause)
+        if (pipe2(fds, O_CLOEXEC) != 0)
         {
-            cnf_file << lit << " ";
+            throw std::runtime_error("Failed to create a pipe for kissat: " + std::string(std::strerror(errno)));
         }
-        cnf_file << "0\n";
     }
-    cnf_file.close();
+}
+
+void SATSolver::Kissat::write_dimacs(const int fd, const std::vector<int>* assumptions) const
+{
+    const std::size_t number_of_assumptions = assumptions != nullptr ? assumptions->size() : 0;
+
+    PipeWriter writer(fd);
+    writer.put("p cnf ");
+    writer.put(number_of_variables);
+    writer.put(' ');
+    writer.put(static_cast<int>(number_of_clauses + number_of_assumptions));
+    writer.put('\n');
+    for (const int lit : literals)
+    {
+        writer.put_literal(lit);
+    }
+    // Kissat runs once per call, so assumptions are just unit clauses of this run
+    for (std::size_t i = 0; i < number_of_assumptions; i++)
+    {
+        writer.put_literal((*assumptions)[i]);
+        writer.put_literal(0);
+    }
+    writer.flush();
+}
 
-    return filename;
+std::unique_ptr<SATSolver::SatSolver> SATSolver::Kissat::clone()
+{
+    auto copy = std::make_unique<Kissat>();
+    copy->literals = literals;
+    copy->number_of_variables = number_of_variables;
+    copy->number_of_clauses = number_of_clauses;
+    return copy;
 }
 
 void SATSolver::Kissat::add_clause(const std::vector<int>& clause)
 {
-    number_of_clauses++;
-    clauses.push_back(clause);
+    count_clause();
+    literals.insert(literals.end(), clause.begin(), clause.end());
+    literals.push_back(0);
 }
 
 void SATSolver::Kissat::add_clause(int l)
 {
-    number_of_clauses++;
-    clauses.push_back({l});
+    count_clause();
+    literals.insert(literals.end(), {l, 0});
 }
 
 void SATSolver::Kissat::add_clause(int l1, int l2)
 {
-    number_of_clauses++;
+    count_clause();
     if (l1 < l2)
     {
-        clauses.push_back({l1, l2});
+        literals.insert(literals.end(), {l1, l2, 0});
     }
     else
     {
-        clauses.push_back({l2, l1});
+        literals.insert(literals.end(), {l2, l1, 0});
     }
 }
 
 void SATSolver::Kissat::add_clause(int l1, int l2, int l3)
 {
-    number_of_clauses++;
+    count_clause();
     const int x = std::min({l1, l2, l3});
     const int z = std::max({l1, l2, l3});
     const int y = l1 + l2 + l3 - x - z;
-    clauses.push_back({x, y, z});
+    literals.insert(literals.end(), {x, y, z, 0});
 }
 
 void SATSolver::Kissat::add_clause(int l1, int l2, int l3, int l4)
 {
-    number_of_clauses++;
-    clauses.push_back({l1, l2, l3, l4});
+    count_clause();
+    literals.insert(literals.end(), {l1, l2, l3, l4, 0});
 }
 
 int SATSolver::Kissat::solve(const std::vector<int>* assumptions, const double time_limit)
@@ -106,68 +192,170 @@ int SATSolver::Kissat::solve(const std::vector<int>* assumptions, const double t
         throw std::runtime_error("kissat not found: " + std::string(KISSAT_PATH));
     }
 
-    if (time_limit != NO_TIME_LIMIT && time_limit < 0.0)
+    if ((time_limit != NO_TIME_LIMIT && time_limit < 0.0) || Deadline::global().expired())
     {
         status = CaDiCaL::Status::UNKNOWN;
         return status;
     }
 
-    if (assumptions != nullptr)
-    {
-        throw std::runtime_error("Kissat solver does not support assumptions.");
-    }
+    // A child killed while its input is still being written must not take this process down with SIGPIPE
+    static const bool ignore_sigpipe = [] { return std::signal(SIGPIPE, SIG_IGN) != SIG_ERR; }();
+    (void)ignore_sigpipe;
 
     const auto start_time = std::chrono::high_resolution_clock::now();
 
-    const auto file_name = write_cnf_to_file();
+    int input[2];
+    int output[2];
+    make_pipe(input);
+    make_pipe(output);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, input[0], STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+
+    // The child leads its own process group so everything it starts goes down with it
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attributes, 0);
+
+    const std::string program = KISSAT_PATH;
+    std::string quiet = "-q";
+    std::vector<char*> argv{const_cast<char*>(program.c_str()), quiet.data(), nullptr};
+
+    pid_t pid;
+    const int spawn_error = posix_spawn(&pid, program.c_str(), &actions, &attributes, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attributes);
+    close(input[0]);
+    close(output[1]);
+    if (spawn_error != 0)
+    {
+        close(input[1]);
+        close(output[0]);
+        throw std::runtime_error("Failed to start kissat: " + std::string(std::strerror(spawn_error)));
+    }
 
-    if (time_limit == NO_TIME_LIMIT)
+    std::string solver_output;
     {
-        const std::string cmd = std::string(KISSAT_PATH) + " " + file_name + " -q -n";
-        const int status = system(cmd.c_str());
+        // The watchdog kills the process group at the end of the slice or at the global deadline
+        const auto watch = Deadline::global().watch(time_limit, [pid] { kill(-pid, SIGKILL); });
 
-        if (const int exitCode = WEXITSTATUS(status); exitCode == 10)
-        {
-            this->status = CaDiCaL::Status::SATISFIABLE;
-        }
-        else if (exitCode == 20)
+        write_dimacs(input[1], assumptions);
+        close(input[1]);
+
+        char chunk[1 << 16];
+        ssize_t n;
+        while ((n = read(output[0], chunk, sizeof(chunk))) != 0)
         {
-            this->status = CaDiCaL::Status::UNSATISFIABLE;
+            if (n > 0)
+            {
+                solver_output.append(chunk, n);
+            }
+            else if (errno != EINTR)
+            {
+                break;
+            }
         }
-        else
+        close(output[0]);
+
+        // Wait for the exit without reaping, so the pid cannot be reused while the watch may still kill it
+        siginfo_t info;
+        while (waitid(P_PID, pid, &info, WEXITED | WNOWAIT) < 0 && errno == EINTR)
         {
-            this->status = CaDiCaL::Status::UNKNOWN;
         }
     }
+
+    int wait_status = 0;
+    rusage usage{};
+    while (wait4(pid, &wait_status, 0, &usage) < 0 && errno == EINTR)
+    {
+    }
+    peak_rss_kb = std::max(peak_rss_kb, static_cast<double>(usage.ru_maxrss));
+
+    if (const int exit_code = WIFEXITED(wait_status) ? WEXITSTATUS(wait_status) : -1; exit_code == 10)
+    {
+        this->status = CaDiCaL::Status::SATISFIABLE;
+    }
+    else if (exit_code == 20)
+    {
+        this->status = CaDiCaL::Status::UNSATISFIABLE;
+    }
     else
     {
-        const std::string cmd =
-            "timeout " + std::to_string(static_cast<int>(time_limit)) +
-            " " + std::string(KISSAT_PATH) + " " + file_name + " -q -n";
-        const int status = system(cmd.c_str());
+        this->status = CaDiCaL::Status::UNKNOWN;
+    }
+
+    if (this->status == CaDiCaL::Status::SATISFIABLE)
+    {
+        read_model(solver_output);
+    }
 
-        if (const int exitCode = WEXITSTATUS(status); exitCode == 10)
-        {
-            this->status = CaDiCaL::Status::SATISFIABLE;
-        }
-        else if (exitCode == 20)
+    const double time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+    time_accum += time;
+
+    SolveRecord record;
+    record.result = this->status;
+    record.time = time;
+    solve_records.push_back(record);
+
+    return this->status;
+}
+
+void SATSolver::Kissat::read_model(const std::string& output)
+{
+    model.assign(number_of_variables + 1, false);
+
+    std::istringstream lines(output);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (line.empty() || line[0] != 'v')
         {
-            this->status = CaDiCaL::Status::UNSATISFIABLE;
+            continue;
         }
-        else
+
+        std::istringstream values(line.substr(1));
+        int lit;
+        while (values >> lit)
         {
-            this->status = CaDiCaL::Status::UNKNOWN;
+            if (lit > 0 && lit <= number_of_variables)
+            {
+                model[lit] = true;
+            }
         }
     }
+}
 
-    time_accum += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_time).count();
+int SATSolver::Kissat::value(const int literal) const
+{
+    const int variable = std::abs(literal);
+    const bool is_true = variable < static_cast<int>(model.size()) && model[variable] == (literal > 0);
+    return is_true ? literal : -literal;
+}
 
-    return this->status;
+void SATSolver::Kissat::set_phase(int)
+{
+    // The kissat binary only takes a global initial phase, so per-variable hints are dropped
+}
+
+void SATSolver::Kissat::set_interrupt(std::function<bool()>)
+{
+    // A kissat run is only stopped by its time slice or the deadline
+}
+
+std::unordered_map<std::string, double> SATSolver::Kissat::get_statistics() const
+{
+    auto stats = SatSolver::get_statistics();
+    stats["peak_rss_kb"] = peak_rss_kb;
+    return stats;
 }
 
 void SATSolver::Kissat::reset()
 {
     number_of_clauses = 0;
     number_of_variables = 0;
-    clauses.clear();
+    literals.clear();
+    model.clear();
 }
@@ -11,17 +11,27 @@ namespace SATSolver
     class Kissat : public SatSolver
     {
     private:
-        std::vector<std::vector<int>> clauses;
+        // Clauses stored back to back, each closed by a 0 as in DIMACS. The capacity survives reset(), so the
+        // previous encoding sizes the next one.
+        std::vector<int> literals;
+        // Truth value of every variable in the last witness, indexed by variable
+        std::vector<bool> model;
 
-        static std::string get_random_filename();
+        // Largest resident set of any kissat run, in kilobytes
+        double peak_rss_kb{};
 
-        [[nodiscard]] std::string write_cnf_to_file() const;
+        // Streams the clauses and the assumptions as unit clauses in DIMACS format
+        void write_dimacs(int fd, const std::vector<int>* assumptions) const;
+
+        void read_model(const std::string& output);
 
     public:
         Kissat() = default;
 
         ~Kissat() override = default;
 
+        [[nodiscard]] std::unique_ptr<SatSolver> clone() override;
+
         void add_clause(const std::vector<int>& clause) override;
 
         void add_clause(int l) override;
@@ -34,7 +44,15 @@ namespace SATSolver
 
         int solve(const std::vector<int>* assumptions, double time_limit) override;
 
+        [[nodiscard]] int value(int literal) const override;
+
+        void set_phase(int literal) override;
+
+        void set_interrupt(std::function<bool()> should_stop) override;
+
         void reset() override;
+
+        [[nodiscard]] std::unordered_map<std::string, double> get_statistics() const override;
     };
 } // SatSolver
 
@@ -4,6 +4,7 @@
 
 #include "SatSolver.h"
 
+#include "cadical.hpp"
 #include "card_encoder/clset.hh"
 #include "card_encoder/seqcounter.hh"
 
@@ -13,12 +14,66 @@ int SATSolver::SatSolver::create_new_variable()
     return number_of_variables;
 }
 
+int SATSolver::SatSolver::create_new_variables(const int count)
+{
+    const int first = number_of_variables + 1;
+    number_of_variables += count;
+    return first;
+}
+
+int SATSolver::SatSolver::solve_cubes(const std::vector<std::vector<int>>& cubes, int,
+                                      const std::vector<int>* assumptions, const double time_limit)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    for (const auto& cube : cubes)
+    {
+        std::vector<int> cube_assumptions = assumptions != nullptr ? *assumptions : std::vector<int>{};
+        cube_assumptions.insert(cube_assumptions.end(), cube.begin(), cube.end());
+
+        double slice = NO_TIME_LIMIT;
+        if (time_limit != NO_TIME_LIMIT)
+        {
+            slice = time_limit - std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        }
+
+        // An unresolved cube leaves the whole formula unresolved
+        if (const int result = solve(&cube_assumptions, slice); result != CaDiCaL::Status::UNSATISFIABLE)
+        {
+            return result;
+        }
+    }
+
+    status = CaDiCaL::Status::UNSATISFIABLE;
+    return status;
+}
+
 std::unordered_map<std::string, double> SATSolver::SatSolver::get_statistics() const
 {
     auto stats = std::unordered_map<std::string, double>();
     stats["total_solving_time"] = time_accum;
     stats["clauses"] = number_of_clauses;
     stats["variables"] = number_of_variables;
+
+    stats["solves"] = static_cast<double>(solve_records.size());
+    stats["learned"] = 0;
+    stats["learned_lits"] = 0;
+    stats["shared_exported"] = 0;
+    stats["shared_imported"] = 0;
+    stats["shared_useful"] = 0;
+    for (const auto& record : solve_records)
+    {
+        stats["learned"] += static_cast<double>(record.learned);
+        stats["learned_lits"] += static_cast<double>(record.learned_literals);
+        stats["shared_exported"] += static_cast<double>(record.exported);
+        stats["shared_imported"] += static_cast<double>(record.imported);
+        stats["shared_useful"] += static_cast<double>(record.useful);
+    }
+    if (!solve_records.empty())
+    {
+        stats["active"] = solve_records.back().active_variables;
+        stats["irredundant"] = static_cast<double>(solve_records.back().irredundant_clauses);
+        stats["redundant"] = static_cast<double>(solve_records.back().redundant_clauses);
+    }
     return stats;
 }
 
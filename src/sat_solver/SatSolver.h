@@ -6,20 +6,48 @@
 #define BCP_SATSOLVER_H
 
 #include <chrono>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+#include "ClauseExchange.h"
+#include "Deadline.h"
 
 static constexpr double NO_TIME_LIMIT = std::numeric_limits<double>::lowest();
 
 namespace SATSolver
 {
+    // Clauses added between two cooperative deadline checks
+    static constexpr int DEADLINE_CHECK_INTERVAL = 4096;
+
     enum SOLVER
     {
         CADICAL,
         KISSAT
     };
 
+    // Outcome of one solve call
+    struct SolveRecord
+    {
+        int result{};
+        double time{};
+        // Formula size after the call; zero for backends that do not report it
+        int active_variables{};
+        long long irredundant_clauses{};
+        long long redundant_clauses{};
+        // Clauses learned during the call and their total length
+        long long learned{};
+        long long learned_literals{};
+        // Learned clauses handed to the clause exchange, clauses taken from it and those of them not already
+        // satisfied at the root
+        long long exported{};
+        long long imported{};
+        long long useful{};
+    };
+
     class SatSolver
     {
     protected:
@@ -27,6 +55,18 @@ namespace SATSolver
         int number_of_variables{};
         int status{};
         double time_accum{};
+        std::vector<SolveRecord> solve_records;
+        // Longest learned clause the copies solving cubes share; 0 disables sharing
+        int shared_clause_size{};
+
+        // Counts an added clause; long encodings stop here once the deadline has passed
+        void count_clause()
+        {
+            if (++number_of_clauses % DEADLINE_CHECK_INTERVAL == 0)
+            {
+                Deadline::global().check();
+            }
+        }
 
     public:
         SatSolver() = default;
@@ -35,6 +75,22 @@ namespace SATSolver
 
         [[nodiscard]] int create_new_variable();
 
+        [[nodiscard]] int get_number_of_variables() const { return number_of_variables; }
+
+        void set_shared_clause_size(const int size) { shared_clause_size = size; }
+
+        // Allocates a contiguous block of variables and returns the first one.
+        [[nodiscard]] int create_new_variables(int count);
+
+        // Independent solver holding the same formula and phases, to be solved from another thread
+        [[nodiscard]] virtual std::unique_ptr<SatSolver> clone() =0;
+
+        // Appends the solve records of a clone to this solver's own
+        void absorb_solves(const SatSolver& other)
+        {
+            solve_records.insert(solve_records.end(), other.solve_records.begin(), other.solve_records.end());
+        }
+
         virtual void add_clause(const std::vector<int>& clause)=0;
 
         virtual void add_clause(int l)=0;
@@ -53,6 +109,31 @@ namespace SATSolver
 
         int solve(const double time_limit) { return solve(nullptr, time_limit); }
 
+        // Solves the formula once per cube, each cube being extra literals assumed together with the assumptions.
+        // Stops at the first satisfiable cube, whose model value() then reports, and is unsatisfiable when every cube
+        // is. Cubes run one after another unless the backend overrides this to use the given number of threads.
+        virtual int solve_cubes(const std::vector<std::vector<int>>& cubes, int threads,
+                                const std::vector<int>* assumptions, double time_limit);
+
+        // Value of a literal in the model of the last satisfiable solve: the literal if it is true, its negation
+        // otherwise.
+        [[nodiscard]] virtual int value(int literal) const =0;
+
+        // Preferred decision value of the literal's variable for the following solves
+        virtual void set_phase(int literal) =0;
+
+        // Polled during the following solves; the search stops early once it returns true
+        virtual void set_interrupt(std::function<bool()> should_stop) =0;
+
+        // Exports short learned clauses to the exchange under the given id and imports those of the other solvers
+        // before every solve. Only solvers on copies of one formula may share. Ignored by default.
+        virtual void share_clauses(ClauseExchange*, int)
+        {
+        }
+
+        // One record per solve call since construction, resets included
+        [[nodiscard]] const std::vector<SolveRecord>& get_solve_records() const { return solve_records; }
+
         [[nodiscard]] virtual std::unordered_map<std::string, double> get_statistics() const;
 
         virtual void reset()=0;
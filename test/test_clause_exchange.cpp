@@ -0,0 +1,128 @@
+#include "test_common.h"
+
+#include <cstdint>
+#include <thread>
+
+#include "sat_solver/ClauseExchange.h"
+
+namespace
+{
+    std::vector<std::vector<int>> drain_all(const SATSolver::ClauseExchange& exchange, const int consumer,
+                                            std::uint64_t& cursor)
+    {
+        std::vector<std::vector<int>> clauses;
+        exchange.drain(consumer, cursor, [&](const std::vector<int>& clause) { clauses.push_back(clause); });
+        return clauses;
+    }
+}
+
+TEST(ClauseExchangeTest, FiltersBySizeAndVariables)
+{
+    SATSolver::ClauseExchange exchange(3, 10);
+    EXPECT_TRUE(exchange.offer(0, {1, -2, 3}));
+    EXPECT_FALSE(exchange.offer(0, {1, 2, 3, 4}));
+    EXPECT_FALSE(exchange.offer(0, {1, -11}));
+    EXPECT_FALSE(exchange.offer(0, {}));
+
+    std::uint64_t cursor = 0;
+    const auto clauses = drain_all(exchange, 1, cursor);
+    ASSERT_EQ(clauses.size(), 1u);
+    EXPECT_EQ(clauses[0], (std::vector{1, -2, 3}));
+    EXPECT_TRUE(drain_all(exchange, 1, cursor).empty());
+}
+
+TEST(ClauseExchangeTest, SkipsOwnClauses)
+{
+    SATSolver::ClauseExchange exchange(8, 100);
+    exchange.offer(0, {1, 2});
+    exchange.offer(1, {-3});
+
+    std::uint64_t cursor = 0;
+    const auto clauses = drain_all(exchange, 0, cursor);
+    ASSERT_EQ(clauses.size(), 1u);
+    EXPECT_EQ(clauses[0], std::vector{-3});
+}
+
+TEST(ClauseExchangeTest, SlowConsumerKeepsNewestClauses)
+{
+    SATSolver::ClauseExchange exchange(8, 100000);
+    for (int i = 1; i <= 10000; i++)
+    {
+        exchange.offer(0, {i});
+    }
+
+    std::uint64_t cursor = 0;
+    const auto clauses = drain_all(exchange, 1, cursor);
+    ASSERT_FALSE(clauses.empty());
+    EXPECT_LT(clauses.size(), 10000u);
+    EXPECT_EQ(clauses.back(), std::vector{10000});
+}
+
+TEST(ClauseExchangeTest, ConcurrentProducersDeliverWholeClauses)
+{
+    SATSolver::ClauseExchange exchange(4, 1000);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; p++)
+    {
+        producers.emplace_back([&, p]
+        {
+            // Every clause repeats its first literal, so a torn one is easy to spot
+            for (int i = 1; i <= 900; i++)
+            {
+                exchange.offer(p, {i, i, i, i});
+            }
+        });
+    }
+
+    std::uint64_t cursor = 0;
+    std::size_t received = 0;
+    bool torn = false;
+    const auto check = [&](const std::vector<int>& clause)
+    {
+        received++;
+        torn |= clause.size() != 4 || clause[1] != clause[0] || clause[2] != clause[0] || clause[3] != clause[0];
+    };
+    for (int round = 0; round < 100; round++)
+    {
+        exchange.drain(-1, cursor, check);
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    exchange.drain(-1, cursor, check);
+
+    EXPECT_FALSE(torn);
+    EXPECT_GT(received, 0u);
+}
+
+TEST(ClauseExchangeTest, ProbeThreadsShareLearnedClauses_GEOM30a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM30a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (const int shared_clause_size : {0, 8})
+    {
+        SCOPED_TRACE(shared_clause_size);
+        BCPSolver::SolverOptions options;
+        options.probe_threads = 3;
+        options.shared_clause_size = shared_clause_size;
+
+        const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+            BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, 40, false, true, "", options));
+        EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, "both"), BCPSolver::OPTIMAL);
+        EXPECT_EQ(s->get_span(), 27);
+        EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+
+        auto stats = s->get_statistics();
+        EXPECT_LE(stats["shared_useful"], stats["shared_imported"]);
+        if (shared_clause_size == 0)
+        {
+            EXPECT_EQ(stats["shared_exported"], 0);
+        }
+        else
+        {
+            EXPECT_GT(stats["shared_exported"], 0);
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bcp_solver/bcp_solver.h"
+#include "bcp_solver/heuristic/Coloring.h"
 #include "bcp_solver/utility.h"
 #include <gtest/gtest.h>
 
@@ -55,5 +56,17 @@ namespace BCPSolver::test
         const auto status = s->solve(NO_TIME_LIMIT, find_optimal, incremental, variable_for_incremental);
         EXPECT_EQ(status, expected_status);
         EXPECT_EQ(s->get_span(), expected_span);
+
+        // The witness read back from the model fits in the reported span
+        if (expected_span > 0)
+        {
+            const auto coloring = s->get_coloring();
+            EXPECT_TRUE(is_valid_coloring(*g, coloring));
+            EXPECT_LE(get_coloring_span(coloring), expected_span);
+            if (expected_status == OPTIMAL)
+            {
+                EXPECT_EQ(get_coloring_span(coloring), expected_span);
+            }
+        }
     }
 } // namespace BCPSolver::test
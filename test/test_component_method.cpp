@@ -0,0 +1,114 @@
+#include "test_common.h"
+
+#include "bcp_solver/method/ComponentMethod.h"
+
+using BCPSolver::SolverStatus;
+
+TEST(ComponentMethodTest, FindsComponentsLargestFirst)
+{
+    BCPSolver::Graph g(7);
+    g.add_edge(0, 4, 2);
+    g.add_edge(4, 6, 1);
+    g.add_edge(2, 5, 3);
+    g.build_adjacency();
+
+    const auto components = BCPSolver::ComponentMethod::find_components(&g);
+    ASSERT_EQ(components.size(), 4u);
+    EXPECT_EQ(components[0], (std::vector{0, 4, 6}));
+    EXPECT_EQ(components[1], (std::vector{2, 5}));
+    EXPECT_EQ(components[2], std::vector{1});
+    EXPECT_EQ(components[3], std::vector{3});
+}
+
+TEST(ComponentMethodTest, IsolatedVerticesAreNotEncoded)
+{
+    BCPSolver::Graph g(5);
+    g.add_edge(0, 1, 3);
+    g.build_adjacency();
+
+    BCPSolver::SolverOptions options;
+    options.component_threads = 1;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::TwoVariablesGreater, &g, SATSolver::CADICAL, 10, false, false, "", options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, "both"), SolverStatus::OPTIMAL);
+    EXPECT_EQ(s->get_span(), 4);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(g, s->get_coloring()));
+
+    // Only the two vertices of the edge have color variables
+    auto stats = s->get_statistics();
+    EXPECT_EQ(stats["components"], 4);
+    EXPECT_EQ(stats["isolated_vertices"], 3);
+    EXPECT_LE(stats["variables"], 2 * 2 * 10 + 10);
+}
+
+TEST(ComponentMethodTest, Optimal_GEOM20_GEOM20a_GEOM30_GEOM40)
+{
+    struct Case
+    {
+        const char* path;
+        int expected_span;
+    };
+    constexpr Case cases[] = {
+        {"../dataset/GEOM20.col", 21},
+        {"../dataset/GEOM20a.col", 20},
+        {"../dataset/GEOM30.col", 28},
+        {"../dataset/GEOM40.col", 28}
+    };
+
+    for (const auto& [path, expected_span] : cases)
+    {
+        const auto g = BCPSolver::test::load_graph(path);
+        ASSERT_NE(g, nullptr);
+        for (const int threads : {1, 3})
+        {
+            for (const bool incremental : {false, true})
+            {
+                SCOPED_TRACE(std::string(path) + " / threads=" + std::to_string(threads) + " / incremental=" +
+                    (incremental ? "on" : "off"));
+                BCPSolver::SolverOptions options;
+                options.component_threads = threads;
+                const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                    BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, -1, false, false, "", options));
+                EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, incremental, "both"), SolverStatus::OPTIMAL);
+                EXPECT_EQ(s->get_span(), expected_span);
+                EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+                EXPECT_GT(s->get_statistics()["components"], 1);
+            }
+        }
+    }
+}
+
+TEST(ComponentMethodTest, SmallComponentsSkipTheSatSolver_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    BCPSolver::SolverOptions options;
+    options.component_threads = 1;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::OneVariableGreater, g.get(), SATSolver::KISSAT, -1, false, false, "", options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true), SolverStatus::OPTIMAL);
+    EXPECT_EQ(s->get_span(), 20);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+
+    // The largest component sets the span; the two small ones fit under it with their heuristic colorings
+    auto stats = s->get_statistics();
+    EXPECT_EQ(stats["components"], 4);
+    EXPECT_EQ(stats["isolated_vertices"], 1);
+    EXPECT_EQ(stats["components_skipped"], 2);
+}
+
+TEST(ComponentMethodTest, NonOptimal_DummyUpperBound_GEOM20)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+
+    BCPSolver::SolverOptions options;
+    options.component_threads = 2;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::StaircaseWithAuxiliaryVarsWithCache, g.get(), SATSolver::CADICAL, 100, true, true, "vary",
+        options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, false), SolverStatus::SATISFIABLE);
+    EXPECT_EQ(s->get_span(), 100);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+}
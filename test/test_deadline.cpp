@@ -0,0 +1,90 @@
+#include "test_common.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST(DeadlineTest, WatchFiresAtEndOfSlice)
+{
+    std::atomic<bool> stopped{false};
+    {
+        const auto watch = SATSolver::Deadline::global().watch(0.05, [&] { stopped = true; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        EXPECT_TRUE(stopped);
+    }
+
+    stopped = false;
+    {
+        const auto watch = SATSolver::Deadline::global().watch(NO_TIME_LIMIT, [&] { stopped = true; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    EXPECT_FALSE(stopped);
+}
+
+TEST(DeadlineTest, ExpiredDeadlineStopsEncoding)
+{
+    auto& deadline = SATSolver::Deadline::global();
+    deadline.arm(0);
+    EXPECT_TRUE(deadline.expired());
+    EXPECT_THROW(deadline.check(), SATSolver::DeadlineExpired);
+    deadline.disarm();
+    EXPECT_FALSE(deadline.expired());
+    EXPECT_EQ(deadline.remaining(), NO_TIME_LIMIT);
+}
+
+TEST(DeadlineTest, TimeLimitCoversEncodingAndSolving_GEOM120a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM120a.col");
+    ASSERT_NE(g, nullptr);
+
+    // The staircase encodings of this graph alone add up to far more than the limit
+    const auto s = BCPSolver::test::make_solver(BCPSolver::StaircaseWithAuxiliaryVarsWithCache, g.get(),
+                                                SATSolver::CADICAL, -1, false, true, "vary");
+    const auto start = std::chrono::steady_clock::now();
+    const auto status = s->solve(0.3, true);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_LT(elapsed, 1.0);
+    EXPECT_EQ(status, BCPSolver::SolverStatus::SATISFIABLE);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+}
+
+TEST(DeadlineTest, FractionalTimeLimitKillsKissat_GEOM120a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM120a.col");
+    ASSERT_NE(g, nullptr);
+
+    const auto s = BCPSolver::test::make_solver(BCPSolver::TwoVariablesGreater, g.get(), SATSolver::KISSAT, -1, false,
+                                                true, "");
+    const auto start = std::chrono::steady_clock::now();
+    s->solve(0.5, true);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_LT(elapsed, 1.2);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+    EXPECT_GT(s->get_statistics()["peak_rss_kb"], 0);
+}
+
+TEST(DeadlineTest, ArmedDeadlineCoversBoundStages_GEOM120a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM120a.col");
+    ASSERT_NE(g, nullptr);
+
+    BCPSolver::SolverOptions options;
+    options.upper_bound_time_limit = 30;
+    options.tabu_time_limit = 30;
+
+    // Armed before the solver is created, as the command line does
+    auto& deadline = SATSolver::Deadline::global();
+    const auto start = std::chrono::steady_clock::now();
+    deadline.arm(0.3);
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, -1, false, true, "", options));
+    s->solve(0.3, true);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_TRUE(deadline.armed());
+    deadline.disarm();
+
+    EXPECT_LT(elapsed, 1.0);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+}
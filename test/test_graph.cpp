@@ -0,0 +1,167 @@
+#include "test_common.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+
+using BCPSolver::Graph;
+using BCPSolver::test::load_graph;
+
+TEST(GraphTest, AdjacencyIsSortedWithAlignedWeights)
+{
+    Graph g(5);
+    g.add_edge(3, 0, 4);
+    g.add_edge(0, 1, 2);
+    g.add_edge(4, 0, 7);
+    g.add_edge(1, 2, 1);
+    g.build_adjacency();
+
+    const auto neighbors = g.get_neighbors(0);
+    const auto weights = g.get_neighbor_weights(0);
+    EXPECT_EQ(std::vector<int>(neighbors.begin(), neighbors.end()), (std::vector<int>{1, 3, 4}));
+    EXPECT_EQ(std::vector<int>(weights.begin(), weights.end()), (std::vector<int>{2, 4, 7}));
+
+    EXPECT_EQ(g.get_degree(0), 3);
+    EXPECT_EQ(g.get_degree(1), 2);
+    EXPECT_EQ(g.get_degree(2), 1);
+    EXPECT_EQ(g.get_max_incident_weight(0), 7);
+    EXPECT_EQ(g.get_max_incident_weight(2), 1);
+
+    EXPECT_EQ(g.get_weight(3, 0), 4);
+    EXPECT_EQ(g.get_weight(0, 3), 4);
+    EXPECT_EQ(g.get_weight(2, 4), 0);
+    EXPECT_EQ(g.get_number_of_edges(), 4);
+}
+
+TEST(GraphTest, CachedInvariants)
+{
+    Graph g(5);
+    g.add_edge(3, 0, 4);
+    g.add_edge(0, 1, 2);
+    g.add_edge(4, 0, 7);
+    g.add_edge(1, 2, 1);
+    g.build_adjacency();
+
+    EXPECT_EQ(g.get_weighted_degree(0), 13);
+    EXPECT_EQ(g.get_weighted_degree(1), 3);
+    EXPECT_EQ(g.get_max_incident_weight(4), 7);
+    EXPECT_EQ(g.get_max_weight(), 7);
+    EXPECT_EQ(g.get_degree_order(), (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(g.get_highest_degree_vertex(), 0);
+}
+
+TEST(GraphTest, RepeatedEdgeKeepsLargestWeight)
+{
+    Graph g(3);
+    g.add_edge(0, 1, 5);
+    g.add_edge(2, 0, 1);
+    g.add_edge(1, 0, 3);
+    g.build_adjacency();
+
+    EXPECT_EQ(g.get_degree(0), 2);
+    EXPECT_EQ(g.get_degree(1), 1);
+    EXPECT_EQ(g.get_weight(0, 1), 5);
+    EXPECT_EQ(g.get_number_of_edges(), 3);
+}
+
+TEST(GraphTest, GEOM20_DegreesMatchEdgeList)
+{
+    const auto g = load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+
+    std::vector degrees(g->get_number_of_nodes(), 0);
+    for (const auto& [u, v, w] : g->get_edges())
+    {
+        degrees[u]++;
+        degrees[v]++;
+        EXPECT_EQ(g->get_weight(u, v), w);
+        EXPECT_EQ(g->get_weight(v, u), w);
+    }
+
+    for (int i = 0; i < g->get_number_of_nodes(); i++)
+    {
+        EXPECT_EQ(g->get_degree(i), degrees[i]);
+    }
+    EXPECT_EQ(std::accumulate(degrees.begin(), degrees.end(), 0), 2 * g->get_number_of_edges());
+}
+
+TEST(GraphTest, BinaryFormatRoundTrip)
+{
+    const auto g = load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    const std::string path = "GEOM20a_roundtrip.bcpg";
+    ASSERT_TRUE(BCPSolver::write_binary_graph(*g, path));
+
+    const auto loaded = load_graph(path);
+    ASSERT_NE(loaded, nullptr);
+
+    EXPECT_EQ(loaded->get_number_of_nodes(), g->get_number_of_nodes());
+    EXPECT_EQ(loaded->get_edges(), g->get_edges());
+    EXPECT_EQ(loaded->get_degree_order(), g->get_degree_order());
+    EXPECT_EQ(loaded->get_max_weight(), g->get_max_weight());
+    for (int i = 0; i < g->get_number_of_nodes(); i++)
+    {
+        const auto expected = g->get_neighbor_weights(i);
+        const auto actual = loaded->get_neighbor_weights(i);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(GraphTest, BinaryFormatRejectsCorruptPayload)
+{
+    const auto g = load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+
+    const std::string path = "GEOM20_corrupt.bcpg";
+    ASSERT_TRUE(BCPSolver::write_binary_graph(*g, path));
+
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('\x7f');
+    }
+
+    EXPECT_EQ(BCPSolver::read_bcp_graph(path), nullptr);
+
+    // An out-of-range neighbor is caught even when the checksum is made to match
+    ASSERT_TRUE(BCPSolver::write_binary_graph(*g, path));
+    std::string bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator(file), {});
+    }
+    constexpr std::size_t header_size = 40;
+    constexpr std::size_t checksum_offset = 32;
+    const std::int32_t out_of_range = g->get_number_of_nodes() + 5;
+    std::memcpy(bytes.data() + header_size + (g->get_number_of_nodes() + 1) * sizeof(std::int32_t), &out_of_range,
+                sizeof(out_of_range));
+
+    // FNV-1a over 64-bit words, then over the trailing bytes, as the writer computes it
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    std::size_t i = header_size;
+    for (; i + sizeof(std::uint64_t) <= bytes.size(); i += sizeof(std::uint64_t))
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes.data() + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+    for (; i < bytes.size(); i++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * 0x100000001b3ULL;
+    }
+    std::memcpy(bytes.data() + checksum_offset, &hash, sizeof(hash));
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    EXPECT_EQ(BCPSolver::read_bcp_graph(path), nullptr);
+
+    std::remove(path.c_str());
+}
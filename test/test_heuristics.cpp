@@ -0,0 +1,97 @@
+#include "test_common.h"
+
+#include "bcp_solver/heuristic/CliqueLowerBound.h"
+#include "bcp_solver/heuristic/Coloring.h"
+#include "bcp_solver/heuristic/DSatur.h"
+#include "bcp_solver/heuristic/MultiStart.h"
+#include "bcp_solver/heuristic/TabuSearch.h"
+
+using BCPSolver::test::load_graph;
+
+TEST(HeuristicTest, DSatur_ProducesValidColorings)
+{
+    for (const auto* path : {"../dataset/GEOM20.col", "../dataset/GEOM60b.col", "../dataset/GEOM120b.col",
+                             "../dataset/c21_1_d1.col"})
+    {
+        SCOPED_TRACE(path);
+        const auto g = load_graph(path);
+        ASSERT_NE(g, nullptr);
+
+        const auto colors = BCPSolver::DSatur(g.get()).run();
+        EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, colors));
+        EXPECT_GE(BCPSolver::get_coloring_span(colors), g->get_max_weight() + 1);
+    }
+}
+
+TEST(HeuristicTest, FirstFitColor_SkipsForbiddenWindows)
+{
+    BCPSolver::Graph g(3);
+    g.add_edge(0, 2, 3);
+    g.add_edge(1, 2, 2);
+    g.build_adjacency();
+
+    std::vector<std::pair<int, int>> intervals;
+    // Color 1 is blocked by vertex 0 up to 3, color 6 by vertex 1 on (4, 8)
+    EXPECT_EQ(BCPSolver::first_fit_color(g, {1, 6, 0}, 2, intervals), 4);
+    EXPECT_EQ(BCPSolver::first_fit_color(g, {1, 5, 0}, 2, intervals), 7);
+    EXPECT_EQ(BCPSolver::first_fit_color(g, {0, 0, 0}, 2, intervals), 1);
+}
+
+TEST(HeuristicTest, MultiStart_NeverWorseThanDSatur)
+{
+    for (const auto* path : {"../dataset/GEOM60b.col", "../dataset/GEOM120b.col"})
+    {
+        SCOPED_TRACE(path);
+        const auto g = load_graph(path);
+        ASSERT_NE(g, nullptr);
+
+        BCPSolver::MultiStartUpperBound heuristic(g.get(), 4, 0.2);
+        const auto colors = heuristic.run();
+        EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, colors));
+        EXPECT_LE(BCPSolver::get_coloring_span(colors),
+                  BCPSolver::get_coloring_span(BCPSolver::DSatur(g.get()).run()));
+        EXPECT_GE(heuristic.get_number_of_starts(), 4);
+        EXPECT_LT(heuristic.get_winning_variant(), BCPSolver::NUMBER_OF_UPPER_BOUND_VARIANTS);
+    }
+}
+
+TEST(HeuristicTest, TabuSearch_LowersSpanKeepingColoringValid)
+{
+    const auto g = load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    const auto initial = BCPSolver::DSatur(g.get()).run();
+    BCPSolver::TabuSearch tabu(g.get(), 0.5);
+    const auto colors = tabu.run(initial);
+
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, colors));
+    EXPECT_LT(BCPSolver::get_coloring_span(colors), BCPSolver::get_coloring_span(initial));
+    // The optimum of GEOM20a is 20
+    EXPECT_GE(BCPSolver::get_coloring_span(colors), 20);
+}
+
+TEST(HeuristicTest, CliqueLowerBound_IsBelowOptimum)
+{
+    // Optimal spans from the published results
+    for (const auto& [path, optimum] : {std::pair{"../dataset/GEOM20a.col", 20}, {"../dataset/GEOM60b.col", 41},
+                                        {"../dataset/c21_1_d1.col", 7}})
+    {
+        SCOPED_TRACE(path);
+        const auto g = load_graph(path);
+        ASSERT_NE(g, nullptr);
+
+        BCPSolver::CliqueLowerBound bound(g.get());
+        const int lower_bound = bound.run();
+        EXPECT_LE(lower_bound, optimum);
+        EXPECT_GE(lower_bound, g->get_max_weight() + 1);
+
+        const auto& clique = bound.get_clique();
+        for (std::size_t i = 0; i < clique.size(); i++)
+        {
+            for (std::size_t j = i + 1; j < clique.size(); j++)
+            {
+                EXPECT_GT(g->get_weight(clique[i], clique[j]), 0);
+            }
+        }
+    }
+}
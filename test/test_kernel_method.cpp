@@ -0,0 +1,102 @@
+#include "test_common.h"
+
+#include "bcp_solver/method/KernelMethod.h"
+
+using BCPSolver::SolverStatus;
+
+TEST(KernelMethodTest, RemovesVerticesIteratively)
+{
+    // A triangle of heavy edges with a path hanging off it
+    BCPSolver::Graph g(5);
+    g.add_edge(0, 1, 4);
+    g.add_edge(1, 2, 4);
+    g.add_edge(0, 2, 4);
+    g.add_edge(2, 3, 2);
+    g.add_edge(3, 4, 2);
+    g.build_adjacency();
+
+    // Vertex 4 blocks 3 colors, then vertex 3 blocks 3 once 4 is gone
+    const auto kernel = BCPSolver::KernelMethod::reduce(&g, 5);
+    EXPECT_EQ(kernel.vertices, (std::vector{0, 1, 2}));
+    EXPECT_EQ(kernel.removed, (std::vector{4, 3}));
+    EXPECT_EQ(kernel.valid_from, 4);
+
+    // Removed together, vertex 3 still counts vertex 4 and the removal holds from a larger span on
+    EXPECT_EQ(BCPSolver::KernelMethod::reduce(&g, 9).valid_from, 7);
+
+    // With a smaller span nothing goes
+    EXPECT_TRUE(BCPSolver::KernelMethod::reduce(&g, 3).removed.empty());
+
+    // With a large one every vertex goes
+    EXPECT_TRUE(BCPSolver::KernelMethod::reduce(&g, 20).vertices.empty());
+}
+
+TEST(KernelMethodTest, Optimal_GEOM20_GEOM20a_GEOM30b_GEOM40)
+{
+    struct Case
+    {
+        const char* path;
+        int expected_span;
+    };
+    constexpr Case cases[] = {
+        {"../dataset/GEOM20.col", 21},
+        {"../dataset/GEOM20a.col", 20},
+        {"../dataset/GEOM30b.col", 26},
+        {"../dataset/GEOM40.col", 28}
+    };
+
+    BCPSolver::SolverOptions options;
+    options.kernelize = true;
+    for (const auto& [path, expected_span] : cases)
+    {
+        const auto g = BCPSolver::test::load_graph(path);
+        ASSERT_NE(g, nullptr);
+        for (const auto solver : {SATSolver::CADICAL, SATSolver::KISSAT})
+        {
+            for (const bool incremental : {false, true})
+            {
+                SCOPED_TRACE(std::string(path) + " / " + std::to_string(solver) + " / incremental=" +
+                    (incremental ? "on" : "off"));
+                const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                    BCPSolver::TwoVariablesGreater, g.get(), solver, -1, false, false, "", options));
+                EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, incremental, "both"), SolverStatus::OPTIMAL);
+                EXPECT_EQ(s->get_span(), expected_span);
+                EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+            }
+        }
+    }
+}
+
+TEST(KernelMethodTest, RechecksTheKernelBelowWhereItHolds_GEOM20b)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20b.col");
+    ASSERT_NE(g, nullptr);
+
+    // A dummy upper bound removes many vertices that the optimal span has to take back
+    BCPSolver::SolverOptions options;
+    options.kernelize = true;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::OneVariableLess, g.get(), SATSolver::CADICAL, 40, true, false, "", options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, "y"), SolverStatus::OPTIMAL);
+    EXPECT_EQ(s->get_span(), 13);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+
+    auto stats = s->get_statistics();
+    EXPECT_GT(stats["kernel_rounds"], 1);
+    EXPECT_LT(stats["kernel_removed"], g->get_number_of_nodes());
+}
+
+TEST(KernelMethodTest, NonOptimal_DummyUpperBound_GEOM20)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+
+    BCPSolver::SolverOptions options;
+    options.kernelize = true;
+    options.component_threads = 2;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::StaircaseWithoutAuxiliaryVars, g.get(), SATSolver::CADICAL, 100, false, true, "fixed", options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, false), SolverStatus::SATISFIABLE);
+    EXPECT_EQ(s->get_span(), 100);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+}
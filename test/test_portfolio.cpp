@@ -0,0 +1,86 @@
+#include "test_common.h"
+
+#include "bcp_solver/method/PortfolioMethod.h"
+
+using BCPSolver::SolverStatus;
+using BCPSolver::test::solve_expect;
+
+TEST(PortfolioTest, SharedBoundsOnlyTighten)
+{
+    BCPSolver::SharedBounds bounds(30, 10);
+    bounds.offer_span(25);
+    bounds.offer_span(28);
+    bounds.offer_lower_bound(15);
+    bounds.offer_lower_bound(12);
+    EXPECT_EQ(bounds.get_best_span(), 25);
+    EXPECT_EQ(bounds.get_lower_bound(), 15);
+    EXPECT_TRUE(bounds.settles(26));
+    EXPECT_TRUE(bounds.settles(14));
+    EXPECT_FALSE(bounds.settles(20));
+    EXPECT_FALSE(bounds.is_optimal());
+
+    bounds.offer_lower_bound(25);
+    EXPECT_TRUE(bounds.is_optimal());
+}
+
+TEST(PortfolioTest, Optimal_GEOM20_GEOM20a_GEOM20b)
+{
+    struct Case
+    {
+        const char* path;
+        int expected_span;
+    };
+    constexpr Case cases[] = {
+        {"../dataset/GEOM20.col", 21},
+        {"../dataset/GEOM20a.col", 20},
+        {"../dataset/GEOM20b.col", 13}
+    };
+
+    for (const auto& [path, expected_span] : cases)
+    {
+        for (const bool incremental : {false, true})
+        {
+            SCOPED_TRACE(std::string(path) + " / incremental=" + (incremental ? "on" : "off"));
+            solve_expect(BCPSolver::Portfolio, path, SATSolver::CADICAL, -1, false, false, "", true, incremental, "",
+                         SolverStatus::OPTIMAL, expected_span);
+        }
+    }
+}
+
+TEST(PortfolioTest, NonOptimal_DummyUpperBound_GEOM20)
+{
+    constexpr int ub = 100;
+    solve_expect(BCPSolver::Portfolio, "../dataset/GEOM20.col", SATSolver::CADICAL, ub, false, true, "", false, false,
+                 "", SolverStatus::SATISFIABLE, ub);
+}
+
+TEST(PortfolioTest, EveryThreadCountReportsItsWorkers_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (int threads = 1; threads <= BCPSolver::PortfolioMethod::MAX_THREADS; threads++)
+    {
+        SCOPED_TRACE(threads);
+        BCPSolver::SolverOptions options;
+        options.portfolio_threads = threads;
+
+        // A dummy upper bound leaves the workers a wide gap to share bounds over
+        const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+            BCPSolver::Portfolio, g.get(), SATSolver::CADICAL, 40, false, false, "", options));
+        EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true), SolverStatus::OPTIMAL);
+        EXPECT_EQ(s->get_span(), 20);
+
+        const auto stats = s->get_statistics();
+        EXPECT_EQ(stats.at("portfolio_threads"), threads);
+        EXPECT_TRUE(stats.contains("worker" + std::to_string(threads - 1) + "_span"));
+    }
+}
+
+TEST(PortfolioTest, RejectsKissat)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+    EXPECT_THROW(BCPSolver::test::make_solver(BCPSolver::Portfolio, g.get(), SATSolver::KISSAT, -1, false, false, ""),
+                 std::invalid_argument);
+}
@@ -0,0 +1,255 @@
+#include "test_common.h"
+
+#include "bcp_solver/span_search.h"
+
+using BCPSolver::SolverStatus;
+
+namespace
+{
+    // Runs a search against a known optimum and returns the probed spans
+    std::vector<int> probes(const BCPSolver::SearchStrategy strategy, const int lower_bound, const int upper_bound,
+                            const int optimum)
+    {
+        BCPSolver::SpanSearch search(strategy, lower_bound, upper_bound);
+        std::vector<int> probed;
+        while (!search.done())
+        {
+            const int span = search.next();
+            probed.push_back(span);
+            search.record(span, span >= optimum ? SolverStatus::SATISFIABLE : SolverStatus::UNSATISFIABLE, 0,
+                          BCPSolver::NO_TIME_LIMIT);
+        }
+        EXPECT_TRUE(search.is_optimal());
+        EXPECT_EQ(search.get_feasible(), optimum);
+        return probed;
+    }
+}
+
+TEST(SpanSearchTest, StrategiesConvergeToOptimum)
+{
+    EXPECT_EQ(probes(BCPSolver::LinearDescending, 10, 20, 15), (std::vector{19, 18, 17, 16, 15, 14}));
+    EXPECT_EQ(probes(BCPSolver::Ascending, 10, 20, 15), (std::vector{10, 11, 12, 13, 14, 15}));
+    EXPECT_EQ(probes(BCPSolver::BinarySearch, 10, 20, 15), (std::vector{14, 17, 15}));
+    EXPECT_EQ(probes(BCPSolver::Galloping, 10, 20, 15), (std::vector{19, 17, 13, 15, 14}));
+    EXPECT_EQ(probes(BCPSolver::Adaptive, 10, 20, 15), (std::vector{19, 18, 17, 16, 15, 14}));
+}
+
+TEST(SpanSearchTest, LowerBoundEndsSearchWithoutProbe)
+{
+    EXPECT_TRUE(probes(BCPSolver::BinarySearch, 15, 15, 15).empty());
+}
+
+TEST(SpanSearchTest, TimedOutProbeIsNotAProof)
+{
+    BCPSolver::SpanSearch search(BCPSolver::LinearDescending, 10, 20);
+    search.record(19, SolverStatus::UNKNOWN, 1, 5);
+    EXPECT_TRUE(search.done());
+    EXPECT_FALSE(search.is_optimal());
+
+    search.retry_unresolved();
+    EXPECT_FALSE(search.done());
+    EXPECT_EQ(search.next(), 19);
+}
+
+TEST(SpanSearchTest, Optimal_AllStrategies_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (const auto strategy : {BCPSolver::LinearDescending, BCPSolver::Ascending, BCPSolver::BinarySearch,
+                                BCPSolver::Galloping, BCPSolver::Adaptive})
+    {
+        SCOPED_TRACE(strategy);
+        BCPSolver::SolverOptions options;
+        options.search_strategy = strategy;
+
+        const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+            BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, -1, false, false, "", options));
+        EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true), SolverStatus::OPTIMAL);
+        EXPECT_EQ(s->get_span(), 20);
+    }
+}
+
+TEST(SpanSearchTest, Optimal_Incremental_AllMethodsAndStrategies_GEOM20a)
+{
+    struct Case
+    {
+        BCPSolver::SolvingMethod method;
+        const char* width;
+        const char* variable_for_incremental;
+    };
+
+    constexpr Case cases[] = {
+        {BCPSolver::OneVariableGreater, "", "y"},
+        {BCPSolver::OneVariableLess, "", "y"},
+        {BCPSolver::TwoVariablesGreater, "", "both"},
+        {BCPSolver::TwoVariablesLess, "", "x"},
+        {BCPSolver::StaircaseWithAuxiliaryVarsWithCache, "vary", "x"},
+        {BCPSolver::StaircaseWithoutAuxiliaryVars, "fixed", "x"},
+    };
+
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (const auto& [method, width, variable] : cases)
+    {
+        for (const auto strategy : {BCPSolver::LinearDescending, BCPSolver::Ascending, BCPSolver::BinarySearch})
+        {
+            SCOPED_TRACE(std::to_string(method) + " / " + variable + " / strategy " + std::to_string(strategy));
+            BCPSolver::SolverOptions options;
+            options.search_strategy = strategy;
+
+            // A dummy upper bound leaves a wide gap to search on one formula
+            const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                method, g.get(), SATSolver::CADICAL, 40, false, false, width, options));
+            EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, variable), SolverStatus::OPTIMAL);
+            EXPECT_EQ(s->get_span(), 20);
+        }
+    }
+}
+
+TEST(SpanSearchTest, Optimal_PhaseSeedingOnOff_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (const bool phase_seeding : {true, false})
+    {
+        SCOPED_TRACE(phase_seeding);
+        BCPSolver::SolverOptions options;
+        options.phase_seeding = phase_seeding;
+
+        const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+            BCPSolver::StaircaseWithAuxiliaryVarsWithCache, g.get(), SATSolver::CADICAL, -1, false, true, "vary",
+            options));
+        EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, "x"), SolverStatus::OPTIMAL);
+        EXPECT_EQ(s->get_span(), 20);
+    }
+}
+
+TEST(SpanSearchTest, Optimal_CubeThreads_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    struct Config
+    {
+        BCPSolver::SolvingMethod method;
+        std::string width;
+        std::string variable_for_incremental;
+        bool use_heuristic;
+    };
+    const std::vector<Config> configs{
+        {BCPSolver::OneVariableGreater, "", "y", false},
+        {BCPSolver::OneVariableLess, "", "y", false},
+        {BCPSolver::TwoVariablesGreater, "", "both", true},
+        {BCPSolver::StaircaseWithAuxiliaryVarsWithCache, "vary", "x", true},
+    };
+
+    for (const auto& config : configs)
+    {
+        for (const int cube_threads : {1, 3})
+        {
+            for (const bool incremental : {false, true})
+            {
+                SCOPED_TRACE(std::to_string(config.method) + " cube_threads " + std::to_string(cube_threads) +
+                    (incremental ? " incremental" : ""));
+                BCPSolver::SolverOptions options;
+                options.cube_threads = cube_threads;
+
+                const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                    config.method, g.get(), SATSolver::CADICAL, 30, false, config.use_heuristic, config.width,
+                    options));
+                EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, incremental, config.variable_for_incremental),
+                          SolverStatus::OPTIMAL);
+                EXPECT_EQ(s->get_span(), 20);
+                EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+            }
+        }
+    }
+}
+
+TEST(SpanSearchTest, Optimal_ProbeThreads_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    for (const auto solver : {SATSolver::CADICAL, SATSolver::KISSAT})
+    {
+        for (const int probe_threads : {2, 3})
+        {
+            SCOPED_TRACE(std::to_string(solver) + " probe_threads " + std::to_string(probe_threads));
+            BCPSolver::SolverOptions options;
+            options.probe_threads = probe_threads;
+
+            const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                BCPSolver::TwoVariablesGreater, g.get(), solver, 30, false, true, "", options));
+            EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, true, "both"), SolverStatus::OPTIMAL);
+            EXPECT_EQ(s->get_span(), 20);
+            EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+            EXPECT_GT(s->get_statistics()["concurrent_probe_time"], 0);
+        }
+    }
+}
+
+TEST(SpanSearchTest, Optimal_Cegar_GEOM20a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20a.col");
+    ASSERT_NE(g, nullptr);
+
+    struct Case
+    {
+        BCPSolver::SolvingMethod method;
+        const char* width;
+        const char* variable_for_incremental;
+    };
+    constexpr Case cases[] = {
+        {BCPSolver::TwoVariablesGreater, "", "both"},
+        {BCPSolver::TwoVariablesLess, "", "both"},
+        {BCPSolver::OneVariableGreater, "", "y"},
+        {BCPSolver::OneVariableLess, "", "y"},
+        {BCPSolver::StaircaseWithAuxiliaryVarsWithCache, "vary", "x"},
+        {BCPSolver::StaircaseWithoutAuxiliaryVars, "fixed", "x"}
+    };
+
+    BCPSolver::SolverOptions options;
+    options.cegar = true;
+    for (const auto& [method, width, variable_for_incremental] : cases)
+    {
+        for (const auto solver : {SATSolver::CADICAL, SATSolver::KISSAT})
+        {
+            for (const bool incremental : {false, true})
+            {
+                SCOPED_TRACE(std::to_string(method) + " / " + std::to_string(solver) + " / incremental=" +
+                    (incremental ? "on" : "off"));
+                const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+                    method, g.get(), solver, 30, false, false, width, options));
+                EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, true, incremental, variable_for_incremental),
+                          SolverStatus::OPTIMAL);
+                EXPECT_EQ(s->get_span(), 20);
+                EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+
+                auto stats = s->get_statistics();
+                EXPECT_LE(stats["cegar_edges"], g->get_number_of_edges());
+            }
+        }
+    }
+}
+
+TEST(SpanSearchTest, Cegar_EncodesPartOfTheEdges_GEOM60b)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM60b.col");
+    ASSERT_NE(g, nullptr);
+
+    BCPSolver::SolverOptions options;
+    options.cegar = true;
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, -1, false, false, "", options));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, false), SolverStatus::SATISFIABLE);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+    EXPECT_LT(s->get_statistics()["cegar_edges"], g->get_number_of_edges());
+
+    options.probe_threads = 2;
+    EXPECT_THROW(BCPSolver::BCPSolver::create_solver(BCPSolver::TwoVariablesGreater, g.get(), SATSolver::CADICAL, -1,
+                     false, false, "", options), std::invalid_argument);
+}
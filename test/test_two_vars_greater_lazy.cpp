@@ -0,0 +1,76 @@
+#include "test_common.h"
+
+using BCPSolver::SolverStatus;
+using BCPSolver::test::solve_expect;
+
+TEST(TwoVariableGreaterLazyEncodingTest, GEOM20_NonOptimal_DummyUpperBound)
+{
+    for (const bool symm : {false, true})
+    {
+        constexpr int ub = 100;
+        SCOPED_TRACE(std::string("symmetry=") + (symm ? "on" : "off"));
+        solve_expect(BCPSolver::TwoVariablesGreaterLazy, "../dataset/GEOM20.col", SATSolver::CADICAL, ub, symm, false,
+                     "", false, false, "", SolverStatus::SATISFIABLE, ub);
+    }
+}
+
+TEST(TwoVariableGreaterLazyEncodingTest, Optimal_GEOM20_GEOM20a_GEOM20b_GEOM30b)
+{
+    struct Case
+    {
+        const char* path;
+        int expected_span;
+    };
+    constexpr Case cases[] = {
+        {"../dataset/GEOM20.col", 21},
+        {"../dataset/GEOM20a.col", 20},
+        {"../dataset/GEOM20b.col", 13},
+        {"../dataset/GEOM30b.col", 26}
+    };
+
+    for (const auto& [path, expected_span] : cases)
+    {
+        for (const bool symm : {false, true})
+        {
+            SCOPED_TRACE(std::string(path) + " / symmetry=" + (symm ? "on" : "off"));
+            solve_expect(BCPSolver::TwoVariablesGreaterLazy, path, SATSolver::CADICAL, -1, symm, false, "", true,
+                         false, "", SolverStatus::OPTIMAL, expected_span);
+            for (const std::string variable_for_incremental : {"x", "y", "both"})
+            {
+                SCOPED_TRACE(variable_for_incremental);
+                solve_expect(BCPSolver::TwoVariablesGreaterLazy, path, SATSolver::CADICAL, -1, symm, false, "", true,
+                             true, variable_for_incremental, SolverStatus::OPTIMAL, expected_span);
+            }
+        }
+    }
+}
+
+TEST(TwoVariableGreaterLazyEncodingTest, AddsOnlyPartOfTheDistanceClauses_GEOM40a)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM40a.col");
+    ASSERT_NE(g, nullptr);
+
+    const std::unique_ptr<BCPSolver::BCPSolver> s(BCPSolver::BCPSolver::create_solver(
+        BCPSolver::TwoVariablesGreaterLazy, g.get(), SATSolver::CADICAL, 60, false, false));
+    EXPECT_EQ(s->solve(BCPSolver::NO_TIME_LIMIT, false), SolverStatus::SATISFIABLE);
+    EXPECT_TRUE(BCPSolver::is_valid_coloring(*g, s->get_coloring()));
+
+    // The eager encoding has one distance clause per edge and color
+    const auto stats = s->get_statistics();
+    EXPECT_GT(stats.at("lazy_clauses"), 0);
+    EXPECT_LT(stats.at("lazy_clauses"), 60.0 * g->get_number_of_edges());
+}
+
+TEST(TwoVariableGreaterLazyEncodingTest, RejectsKissatAndCopies)
+{
+    const auto g = BCPSolver::test::load_graph("../dataset/GEOM20.col");
+    ASSERT_NE(g, nullptr);
+
+    EXPECT_THROW(BCPSolver::BCPSolver::create_solver(BCPSolver::TwoVariablesGreaterLazy, g.get(), SATSolver::KISSAT),
+                 std::invalid_argument);
+
+    BCPSolver::SolverOptions options;
+    options.probe_threads = 2;
+    EXPECT_THROW(BCPSolver::BCPSolver::create_solver(BCPSolver::TwoVariablesGreaterLazy, g.get(),
+                     SATSolver::CADICAL, -1, true, false, "", options), std::invalid_argument);
+}